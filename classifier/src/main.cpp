@@ -2,7 +2,9 @@
 #include <gflags/gflags.h>
 #define GLOG_NO_ABBREVIATED_SEVERITIES
 #include <glog/logging.h>
+#include <ATen/Parallel.h>
 
+#include <algorithm>
 #include <boost/algorithm/string.hpp>
 #include <boost/filesystem.hpp>
 #include <cstdio>
@@ -16,8 +18,10 @@
 
 #include "classify.h"
 #include "easyipc.h"
+#include "handler_registry.h"
 #include "infer.h"
 #include "ipc-message/ipc.pb.h"
+#include "mapped_fd.h"
 #include "json/json.hpp"
 
 using std::ifstream;
@@ -39,14 +43,26 @@ using proto::MessageType;
 using proto::MessageType_Name;
 
 static string server_handler(EasyIpc::Context &ctx, const EasyIpc::Message &msg);
+static bool classify_images(EasyIpc::Context &ctx, const EasyIpc::Message &msg,
+                            const ClassifyRequest &request, ClassifyResponse &response);
 static tuple<string, float> classify_image(const fs::path &p);
+static tuple<string, float> classify_image(std::string_view encoded);
 static ClassifierConf ParseClassifierConf(const string &conf);
 
 static vector<string> labels;
 static torch::jit::script::Module model;
+static EasyIpc::HandlerRegistry handlers;
 
 DEFINE_string(conf, "classifier_asset/classifier.conf", "path to classifier configuration file");
 DEFINE_string(logdir, "log", "Dir to put logs");
+DEFINE_string(pools, "",
+              "named thread pools, e.g. io=2,inference=4:cpus=2-5 (see "
+              "ThreadPool::ConfigureFromSpec)");
+DEFINE_bool(instrument_pools, false,
+            "record queueing and run times of the thread pools, served with the metrics");
+DEFINE_int32(torch_threads, 1,
+             "intra-op threads of libtorch for each inference worker, 0 keeps libtorch's "
+             "default");
 
 int main(int argc, char **argv) {
     google::InitGoogleLogging(argv[0]);
@@ -57,6 +73,17 @@ int main(int argc, char **argv) {
     FLAGS_logtostderr = 1;
     FLAGS_stderrthreshold = 0;
 
+    string pools_error;
+    if (!ThreadPool::ConfigureFromSpec(FLAGS_pools, &pools_error)) {
+        LOG(ERROR) << fmt::format("Invalid --pools: {}", pools_error);
+        return -1;
+    }
+    // the inference pool already has a worker per core, libtorch spawning as many
+    // threads again for every one of them only oversubscribes the machine
+    if (FLAGS_torch_threads > 0) {
+        at::set_num_threads(FLAGS_torch_threads);
+    }
+
     if (!boost::filesystem::exists(FLAGS_conf)) {
         LOG(ERROR) << fmt::format("Configuration file {} not exists", FLAGS_conf);
         return -1;
@@ -99,7 +126,27 @@ int main(int argc, char **argv) {
         return -1;
     }
 
+    handlers.RegisterRaw(MessageType::Ping,
+                         [](EasyIpc::Context &ctx, const EasyIpc::Message &msg) { return "OK"; });
+    handlers.Register<ClassifyRequest, ClassifyResponse>(MessageType::ClassifyImage,
+                                                         classify_images);
+
     auto server = std::make_shared<IpcServer>("classify-service");
+    server->serve_mode = EasyIpc::ServeMode::Reactor;
+    // pings stay on the io pool and are answered while batches occupy every
+    // inference worker
+    ThreadPool &io_pool = ThreadPool::Named(ThreadPool::kIoPool);
+    ThreadPool &inference_pool = ThreadPool::Named(ThreadPool::kInferencePool);
+    if (FLAGS_instrument_pools) {
+        io_pool.enable_instrumentation();
+        inference_pool.enable_instrumentation();
+    }
+    server->thread_pool = &io_pool;
+    server->priority_classes = {
+        EasyIpc::PriorityClass{},
+        EasyIpc::PriorityClass{0, 1024, &inference_pool},
+    };
+    server->message_type_priority = {{MessageType::ClassifyImage, 1}};
     server->message_handler = server_handler;
     server->Run();
     return 0;
@@ -107,35 +154,39 @@ int main(int argc, char **argv) {
 
 string server_handler(EasyIpc::Context &ctx, const EasyIpc::Message &msg) {
     LOG(INFO) << "receive message: " << MessageType_Name(msg.message_type);
-    if (msg.message_type == MessageType::Ping) {
-        return "OK";
-    }
-
-    if (msg.message_type != MessageType::ClassifyImage) {
+    if (!handlers.Contains(msg.message_type)) {
         LOG(ERROR) << "Invalid message";
         return "";
     }
+    return handlers.Dispatch(ctx, msg);
+}
 
-    ClassifyRequest request;
-    if (!request.ParseFromString(msg.content)) {
-        LOG(ERROR) << "Invalid message to parse from";
-        return "";
-    }
+bool classify_images(EasyIpc::Context &ctx, const EasyIpc::Message &msg,
+                     const ClassifyRequest &request, ClassifyResponse &response) {
+    // the caller may attach one opened source per image so that we do not re-open them
+    bool has_fds = static_cast<int>(msg.fds.size()) == request.infos_size();
 
-    ClassifyResponse response;
+    // each result is written as a partial ClassifyResponse so that a streaming client
+    // sees it right away, the others receive all of them merged into one response
     for (int i = 0; i < request.infos_size(); i++) {
         const ImageInfo &info = request.infos(i);
         const fs::path &fspath = info.source_path();
-        tuple<string, float> classify_result = classify_image(fspath);
+        EasyIpc::MappedFd source;
+        tuple<string, float> classify_result = has_fds && source.Map(msg.fds[i])
+                                                   ? classify_image(source.bytes())
+                                                   : classify_image(fspath);
 
         LOG(INFO) << fmt::format("{} classify resule: {}, confidence: {}", fspath.c_str(),
                                  std::get<0>(classify_result), std::get<1>(classify_result));
-        ImageClass *img_class = response.add_results();
+        ClassifyResponse partial;
+        ImageClass *img_class = partial.add_results();
         img_class->set_source_path(fspath.string());
         img_class->set_class_name(std::get<0>(classify_result).c_str());
         img_class->set_class_confidence(std::get<1>(classify_result));
+        ctx.Write(partial.SerializeAsString());
+        ctx.Progress(fmt::format("{}/{}", i + 1, request.infos_size()));
     }
-    return response.SerializeAsString();
+    return true;
 }
 
 tuple<string, float> classify_image(const fs::path &p) {
@@ -144,6 +195,13 @@ tuple<string, float> classify_image(const fs::path &p) {
     return res;
 }
 
+tuple<string, float> classify_image(std::string_view encoded) {
+    cv::Mat buf(1, static_cast<int>(encoded.size()), CV_8UC1, const_cast<char *>(encoded.data()));
+    cv::Mat image = cv::imdecode(buf, cv::IMREAD_COLOR);
+    auto res = classify(image, model, labels, /*use_gpu*/ false);
+    return res;
+}
+
 ClassifierConf ParseClassifierConf(const string &conf) {
     ClassifierConf classifier_conf;
     auto json_obj = json::parse(conf);
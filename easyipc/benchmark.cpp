@@ -0,0 +1,326 @@
+//
+// Round-trip latency and throughput of the easyipc transport. An in-process echo
+// server answers every request with its own body; each configuration of payload
+// size, client count and send mode is measured on fresh connections and reported
+// as one CSV or JSON record.
+//
+// usage: easyipc_bench [--clients N] [--min-size B] [--max-size B] [--depth D]
+//                      [--mode sequential|pipelined|both] [--serve blocking|reactor]
+//                      [--io-threads N] [--shm] [--format csv|json] [--budget MiB]
+//
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "easyipc.h"
+
+using EasyIpc::IpcClient;
+using EasyIpc::IpcServer;
+using Clock = std::chrono::steady_clock;
+
+static constexpr char BenchToken[] = "easyipc-bench";
+// bytes of payload moved per configuration and client before it stops
+static constexpr std::size_t DefaultBudgetMiB = 256;
+static constexpr int MinIterations = 8;
+static constexpr int MaxIterations = 20000;
+// bound what a pipelined client keeps in flight so large payloads do not exhaust memory
+static constexpr std::size_t MaxBytesInFlight = 64 * 1024 * 1024;
+
+struct Options {
+    std::size_t max_clients = 4;
+    std::size_t min_size = 0;
+    std::size_t max_size = 64 * 1024 * 1024;
+    std::size_t depth = 16;
+    bool sequential = true;
+    bool pipelined = true;
+    EasyIpc::ServeMode serve_mode = EasyIpc::ServeMode::Reactor;
+    std::size_t io_threads = 1;
+    bool shared_memory = false;
+    bool json = false;
+    std::size_t budget = DefaultBudgetMiB * 1024 * 1024;
+};
+
+struct Result {
+    const char* mode;
+    std::size_t clients;
+    std::size_t size;
+    std::size_t requests;
+    std::size_t errors;
+    double seconds;
+    // per request round trip, microseconds, sorted
+    std::vector<double> latencies;
+};
+
+static double percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty())
+        return 0;
+    std::size_t index = static_cast<std::size_t>(p * (sorted.size() - 1) + 0.5);
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+static double elapsed_us(Clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+static int iterations_for(const Options& options, std::size_t size) {
+    // zero sized requests still cost a header each way
+    std::size_t per_request = std::max<std::size_t>(size, 64);
+    std::size_t n = options.budget / per_request;
+    n = std::min<std::size_t>(MaxIterations, n);
+    return static_cast<int>(std::max<std::size_t>(MinIterations, n));
+}
+
+static void run_sequential(IpcClient& client, const std::string& payload, int iterations,
+                           std::vector<double>& latencies, std::size_t& errors) {
+    std::string resp;
+    for (int i = 0; i < iterations; i++) {
+        resp.clear();
+        auto start = Clock::now();
+        bool ok = client.Send(0, payload, resp);
+        latencies.push_back(elapsed_us(start));
+        if (!ok || resp.size() != payload.size())
+            errors++;
+    }
+}
+
+static void run_pipelined(IpcClient& client, const std::string& payload, int iterations,
+                          std::size_t depth, std::vector<double>& latencies,
+                          std::size_t& errors) {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::size_t in_flight = 0;
+    std::vector<double> completed;
+    std::size_t failed = 0;
+    completed.reserve(iterations);
+
+    for (int i = 0; i < iterations; i++) {
+        {
+            std::unique_lock<std::mutex> lk(mutex);
+            cv.wait(lk, [&] { return in_flight < depth; });
+            in_flight++;
+        }
+
+        auto start = Clock::now();
+        std::size_t expected = payload.size();
+        bool sent = client.SendAsync(0, payload, [&, start, expected](bool ok, std::string& resp) {
+            double latency = elapsed_us(start);
+            std::lock_guard<std::mutex> guard(mutex);
+            completed.push_back(latency);
+            if (!ok || resp.size() != expected)
+                failed++;
+            in_flight--;
+            cv.notify_one();
+        });
+        if (!sent) {
+            std::lock_guard<std::mutex> guard(mutex);
+            in_flight--;
+            failed++;
+        }
+    }
+
+    std::unique_lock<std::mutex> lk(mutex);
+    cv.wait(lk, [&] { return in_flight == 0; });
+    latencies.insert(latencies.end(), completed.begin(), completed.end());
+    errors += failed;
+}
+
+static bool measure(const Options& options, bool pipelined, std::size_t clients,
+                    std::size_t size, Result& result) {
+    std::vector<std::unique_ptr<IpcClient>> connections;
+    for (std::size_t i = 0; i < clients; i++) {
+        auto client = std::make_unique<IpcClient>();
+        if (!client->Connect(BenchToken))
+            return false;
+        if (options.shared_memory)
+            client->EnableSharedMemory();
+        connections.push_back(std::move(client));
+    }
+
+    std::string payload(size, 'x');
+    int iterations = iterations_for(options, size);
+    std::size_t depth = std::max<std::size_t>(
+        1, std::min(options.depth, MaxBytesInFlight / std::max<std::size_t>(size, 1)));
+
+    // warm up: connection setup, first touch of buffers and rings
+    for (auto& client : connections) {
+        std::string resp;
+        client->Send(0, payload, resp);
+    }
+
+    std::vector<std::vector<double>> latencies(clients);
+    std::vector<std::size_t> errors(clients, 0);
+    std::vector<std::thread> threads;
+
+    auto start = Clock::now();
+    for (std::size_t i = 0; i < clients; i++) {
+        threads.emplace_back([&, i] {
+            latencies[i].reserve(iterations);
+            if (pipelined) {
+                run_pipelined(*connections[i], payload, iterations, depth, latencies[i], errors[i]);
+            } else {
+                run_sequential(*connections[i], payload, iterations, latencies[i], errors[i]);
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    double seconds = elapsed_us(start) / 1e6;
+
+    result.mode = pipelined ? "pipelined" : "sequential";
+    result.clients = clients;
+    result.size = size;
+    result.seconds = seconds;
+    result.errors = 0;
+    result.latencies.clear();
+    for (std::size_t i = 0; i < clients; i++) {
+        result.latencies.insert(result.latencies.end(), latencies[i].begin(), latencies[i].end());
+        result.errors += errors[i];
+    }
+    result.requests = result.latencies.size();
+    std::sort(result.latencies.begin(), result.latencies.end());
+
+    for (auto& client : connections) client->Close();
+    return true;
+}
+
+static void print_header(const Options& options) {
+    if (!options.json) {
+        std::printf(
+            "mode,serve_mode,clients,size,requests,errors,seconds,requests_per_sec,mib_per_sec,"
+            "p50_us,p90_us,p99_us,p999_us,max_us\n");
+    }
+}
+
+static void print_result(const Options& options, const Result& r) {
+    const char* serve = options.serve_mode == EasyIpc::ServeMode::Reactor ? "reactor" : "blocking";
+    double rps = r.requests / r.seconds;
+    // the payload crosses the boundary twice per round trip
+    double mibps = 2.0 * r.size * r.requests / r.seconds / (1 << 20);
+    const char* format =
+        options.json
+            ? "{\"mode\":\"%s\",\"serve_mode\":\"%s\",\"clients\":%zu,\"size\":%zu,"
+              "\"requests\":%zu,\"errors\":%zu,\"seconds\":%.6f,\"requests_per_sec\":%.1f,"
+              "\"mib_per_sec\":%.1f,\"p50_us\":%.1f,\"p90_us\":%.1f,\"p99_us\":%.1f,"
+              "\"p999_us\":%.1f,\"max_us\":%.1f}\n"
+            : "%s,%s,%zu,%zu,%zu,%zu,%.6f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f\n";
+    std::printf(format, r.mode, serve, r.clients, r.size, r.requests, r.errors, r.seconds, rps,
+                mibps, percentile(r.latencies, 0.5), percentile(r.latencies, 0.9),
+                percentile(r.latencies, 0.99), percentile(r.latencies, 0.999),
+                r.latencies.empty() ? 0.0 : r.latencies.back());
+    std::fflush(stdout);
+}
+
+static bool parse_options(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (arg == "--shm") {
+            options.shared_memory = true;
+        } else if (arg == "--clients" && has_value) {
+            options.max_clients = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--min-size" && has_value) {
+            options.min_size = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--max-size" && has_value) {
+            options.max_size = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--depth" && has_value) {
+            options.depth = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--io-threads" && has_value) {
+            options.io_threads = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--budget" && has_value) {
+            options.budget = std::max(1ull, std::strtoull(argv[++i], nullptr, 10)) * 1024 * 1024;
+        } else if (arg == "--mode" && has_value) {
+            std::string mode = argv[++i];
+            options.sequential = mode == "sequential" || mode == "both";
+            options.pipelined = mode == "pipelined" || mode == "both";
+        } else if (arg == "--serve" && has_value) {
+            std::string serve = argv[++i];
+            options.serve_mode = serve == "blocking" ? EasyIpc::ServeMode::Blocking
+                                                     : EasyIpc::ServeMode::Reactor;
+        } else if (arg == "--format" && has_value) {
+            options.json = std::string(argv[++i]) == "json";
+        } else {
+            return false;
+        }
+    }
+    return options.sequential || options.pipelined;
+}
+
+// 0, then powers of four from 1 KiB up to the maximum
+static std::vector<std::size_t> payload_sizes(const Options& options) {
+    std::vector<std::size_t> sizes;
+    if (options.min_size == 0)
+        sizes.push_back(0);
+    for (std::size_t size = 1024; size <= options.max_size; size *= 4) {
+        if (size >= options.min_size)
+            sizes.push_back(size);
+    }
+    return sizes;
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parse_options(argc, argv, options)) {
+        std::cerr << "usage: easyipc_bench [--clients N] [--min-size B] [--max-size B] "
+                     "[--depth D] [--mode sequential|pipelined|both] [--serve blocking|reactor] "
+                     "[--io-threads N] [--shm] [--format csv|json] [--budget MiB]"
+                  << std::endl;
+        return 1;
+    }
+
+    auto server = std::make_shared<IpcServer>(BenchToken);
+    server->serve_mode = options.serve_mode;
+    server->io_thread_count = options.io_threads;
+    server->message_handler = [](EasyIpc::Context& ctx, const EasyIpc::Message& msg) {
+        return msg.content;
+    };
+    std::thread server_thread([server] { server->Run(); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    if (options.serve_mode == EasyIpc::ServeMode::Blocking) {
+        // every blocking session holds a pool worker until its client disconnects
+        std::size_t workers = ThreadPool::GlobalPool().size();
+        if (options.max_clients > workers) {
+            std::cerr << "blocking mode serves at most " << workers << " clients at once"
+                      << std::endl;
+            options.max_clients = workers;
+        }
+    }
+
+    print_header(options);
+    for (std::size_t clients = 1; clients <= options.max_clients;
+         clients = clients == options.max_clients ? clients + 1
+                                                  : std::min(clients * 2, options.max_clients)) {
+        for (std::size_t size : payload_sizes(options)) {
+            for (bool pipelined : {false, true}) {
+                if ((pipelined && !options.pipelined) || (!pipelined && !options.sequential))
+                    continue;
+
+                Result result;
+                if (!measure(options, pipelined, clients, size, result)) {
+                    std::cerr << "connect error" << std::endl;
+                    return 1;
+                }
+                print_result(options, result);
+            }
+        }
+    }
+
+    server->Shutdown();
+    if (options.serve_mode == EasyIpc::ServeMode::Blocking) {
+        // the blocking accept loop only notices the shutdown on its next connection
+        IpcClient wakeup;
+        wakeup.Connect(BenchToken);
+    }
+    server_thread.join();
+    return 0;
+}
@@ -1,9 +1,17 @@
 #include "easyipc.h"
 
 #include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <chrono>
 #include <cstdlib>
+#include <cstring>
 #include <thread>
 
+#include "protocol.h"
+#include "reactor.h"
+#include "scheduler.h"
+#include "shm.h"
 #include "utils.h"
 
 #ifdef _WIN32
@@ -15,19 +23,85 @@
 #include <unistd.h>
 #endif
 
-static constexpr std::size_t BufferSize = 8192;
 static constexpr std::size_t MaxTokenSize = 1024;
 static constexpr char EasyIpcPrefix[] = "ani-";
 static constexpr int SocketBackLog = 16;
+// larger buffers are released instead of being kept around by an idle worker
+static constexpr std::size_t MaxRecycledBufferSize = 4 * 1024 * 1024;
 
 namespace EasyIpc {
 
-inline bool ReadBytesFromTunnel(MessageTunnel tunnel, char* buffer, std::size_t size) {
+#ifndef _WIN32
+ssize_t ReceiveWithFds(int socket, char* buffer, std::size_t size, int flags,
+                       std::vector<int>& fds) {
+    iovec iov;
+    iov.iov_base = buffer;
+    iov.iov_len = size;
+
+    char control[CMSG_SPACE(sizeof(int) * MaxFdsPerFrame)];
+    msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+#ifdef MSG_CMSG_CLOEXEC
+    flags |= MSG_CMSG_CLOEXEC;
+#endif
+    ssize_t read_bytes = ::recvmsg(socket, &msg, flags);
+    if (read_bytes < 0)
+        return read_bytes;
+
+    for (cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+        if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS)
+            continue;
+        std::size_t count = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+        const int* received = reinterpret_cast<const int*>(CMSG_DATA(cmsg));
+        fds.insert(fds.end(), received, received + count);
+    }
+    return read_bytes;
+}
+
+ssize_t SendWithFds(int socket, const iovec* iov, int iov_count, const std::vector<int>& fds,
+                    int flags) {
+    msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = const_cast<iovec*>(iov);
+    msg.msg_iovlen = iov_count;
+
+    char control[CMSG_SPACE(sizeof(int) * MaxFdsPerFrame)];
+    if (!fds.empty()) {
+        if (fds.size() > MaxFdsPerFrame) {
+            errno = EINVAL;
+            return -1;
+        }
+        memset(control, 0, sizeof(control));
+        msg.msg_control = control;
+        msg.msg_controllen = CMSG_SPACE(sizeof(int) * fds.size());
+
+        cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+        cmsg->cmsg_level = SOL_SOCKET;
+        cmsg->cmsg_type = SCM_RIGHTS;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(int) * fds.size());
+        memcpy(CMSG_DATA(cmsg), fds.data(), sizeof(int) * fds.size());
+    }
+
+#ifdef MSG_NOSIGNAL
+    flags |= MSG_NOSIGNAL;
+#endif
+    return ::sendmsg(socket, &msg, flags);
+}
+#endif
+
+// Descriptors received along with the bytes are appended to fds if given, and
+// dropped by the kernel otherwise.
+inline bool ReadBytesFromTunnel(MessageTunnel tunnel, char* buffer, std::size_t size,
+                                std::vector<int>* fds = nullptr) {
     if (size == 0)
         return true;
 
     std::size_t index = 0;
-    memset(buffer, 0, size);
     bool ok = false;
 
 #ifdef _WIN32
@@ -51,8 +125,15 @@ inline bool ReadBytesFromTunnel(MessageTunnel tunnel, char* buffer, std::size_t
 #else
     while (true) {
         std::size_t remains_bytes = size - index;
-        int read_bytes = ::recv(tunnel, reinterpret_cast<void*>(buffer + index),
-                                std::min(remains_bytes, BufferSize), 0);
+        ssize_t read_bytes;
+        if (fds) {
+            read_bytes = ReceiveWithFds(tunnel, buffer + index, remains_bytes, 0, *fds);
+        } else {
+            read_bytes = ::recv(tunnel, reinterpret_cast<void*>(buffer + index), remains_bytes, 0);
+        }
+        if (read_bytes < 0 && errno == EINTR) {
+            continue;
+        }
         if (read_bytes <= 0) {
             break;
         }
@@ -103,9 +184,10 @@ inline bool WriteBytesToTunnel(MessageTunnel tunnel, const char* buffer, std::si
 #else
     while (written_count < size) {
         std::size_t remains_count = size - written_count;
-        int written =
-            ::send(tunnel, buffer + written_count, std::min(BufferSize, remains_count), 0);
+        ssize_t written = ::send(tunnel, buffer + written_count, remains_count, 0);
         if (written < 0) {
+            if (errno == EINTR)
+                continue;
             return false;
         }
         written_count += written;
@@ -122,6 +204,82 @@ inline bool WriteStringToTunnel(MessageTunnel tunnel, const std::string& content
     return WriteBytesToTunnel(tunnel, content.c_str(), content.size());
 }
 
+// Write one frame. Large bodies are placed in the shared-memory ring when there is
+// one and it has room, and only the doorbell goes through the tunnel.
+static bool WriteFrame(MessageTunnel tunnel, MessageHeader header, const std::string& body,
+                       SharedMemoryRing* ring, const std::vector<int>& fds = {}) {
+    const char* body_data = body.data();
+    std::size_t body_size = body.size();
+
+    SharedMemoryDoorbell doorbell;
+    if (ring && body_size >= SharedMemoryThreshold && ring->Write(body_data, body_size, doorbell)) {
+        header.flags |= FlagSharedMemory;
+        body_data = reinterpret_cast<const char*>(&doorbell);
+        body_size = sizeof(doorbell);
+    }
+    header.body_size = body_size;
+    header.fd_count = fds.size();
+
+#ifndef _WIN32
+    if (!fds.empty()) {
+        // the descriptors travel with the header bytes
+        iovec iov;
+        iov.iov_base = &header;
+        iov.iov_len = sizeof(MessageHeader);
+        ssize_t written;
+        do {
+            written = SendWithFds(tunnel, &iov, 1, fds, 0);
+        } while (written < 0 && errno == EINTR);
+        if (written < 0) {
+            return false;
+        }
+        return WriteBytesToTunnel(tunnel, reinterpret_cast<const char*>(&header) + written,
+                                  sizeof(MessageHeader) - written) &&
+               WriteBytesToTunnel(tunnel, body_data, body_size);
+    }
+#endif
+
+    return WriteBytesToTunnel(tunnel, reinterpret_cast<const char*>(&header),
+                              sizeof(MessageHeader)) &&
+           WriteBytesToTunnel(tunnel, body_data, body_size);
+}
+
+// Read the body of a frame whose header has been read, resolving doorbells.
+static bool ReadFrameBody(MessageTunnel tunnel, const MessageHeader& header,
+                          SharedMemoryRing* ring, std::string& body) {
+    if (!ReadStringFromTunnel(tunnel, body, header.body_size)) {
+        return false;
+    }
+
+    if (header.flags & FlagSharedMemory) {
+        SharedMemoryDoorbell doorbell;
+        if (!ring || body.size() != sizeof(doorbell)) {
+            return false;
+        }
+        memcpy(&doorbell, body.data(), sizeof(doorbell));
+        return ring->Read(doorbell, body);
+    }
+    return true;
+}
+
+// Take the descriptors a frame announced off the front of the received queue.
+// Returns false if the peer sent fewer than it announced.
+static bool TakeFds(std::vector<int>& received, std::uint32_t count, std::vector<int>& fds) {
+    if (received.size() < count) {
+        return false;
+    }
+    fds.assign(received.begin(), received.begin() + count);
+    received.erase(received.begin(), received.begin() + count);
+    return true;
+}
+
+static void CloseFds(std::vector<int>& fds) {
+#ifndef _WIN32
+    for (int fd : fds) ::close(fd);
+#endif
+    fds.clear();
+}
+
 inline void CloseTunnel(MessageTunnel tunnel) {
 #ifdef _WIN32
     ::CloseHandle(tunnel);
@@ -130,12 +288,148 @@ inline void CloseTunnel(MessageTunnel tunnel) {
 #endif
 }
 
-class MessageHeader {
-   public:
-    std::int32_t message_type = -1;
-    std::int64_t request_id = 0;
-    std::uint32_t body_size = 0;
-};
+using Clock = std::chrono::steady_clock;
+
+// Records what is known about a request before its handler runs.
+static MessageTypeMetrics& StartHandlerMetrics(const std::shared_ptr<IpcServer>& server,
+                                               const Message& req, Clock::time_point start) {
+    MessageTypeMetrics& metrics = server->metrics().ForType(req.message_type);
+    if (req.received_at != Clock::time_point()) {
+        metrics.queue_wait_ns.record(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(start - req.received_at).count());
+    }
+    metrics.request_bytes.record(req.content.size());
+    return metrics;
+}
+
+// Puts the partial results buffered in ctx in front of the response, takes the
+// descriptors the handler attached and records the outcome.
+static void FinishHandler(MessageTypeMetrics& metrics, Clock::time_point start, Context& ctx,
+                          bool failed, std::string& response_content,
+                          std::vector<int>& response_fds) {
+    if (failed || ctx.failed()) {
+        metrics.errors.fetch_add(1, std::memory_order_relaxed);
+    }
+    std::string buffered = ctx.TakeBuffered();
+    if (!buffered.empty()) {
+        response_content.insert(0, buffered);
+    }
+    response_fds.swap(ctx.response_fds());
+
+    metrics.handler_ns.record(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+    metrics.response_bytes.record(response_content.size());
+}
+
+std::string InvokeMessageHandler(const std::shared_ptr<IpcServer>& server, const Message& req,
+                                 std::vector<int>& response_fds,
+                                 const Context::FrameWriter& frame_writer) {
+    if (req.message_type == MetricsMessageType) {
+        return server->MetricsSnapshot();
+    }
+
+    auto start = Clock::now();
+    MessageTypeMetrics& metrics = StartHandlerMetrics(server, req, start);
+
+    std::string response_content;
+    Context ctx(server, frame_writer);
+    bool failed = false;
+    try {
+        if (server->async_message_handler) {
+            // ctx and req outlive the future, this thread waits for it (helping with
+            // the pool's tasks if it is a worker)
+            response_content = server->async_message_handler(ctx, req).get();
+        } else if (server->message_handler) {
+            response_content = server->message_handler(ctx, req);
+        }
+    } catch (...) {
+        response_content.clear();
+        failed = true;
+    }
+    FinishHandler(metrics, start, ctx, failed, response_content, response_fds);
+    return response_content;
+}
+
+void InvokeAsyncMessageHandler(const std::shared_ptr<IpcServer>& server, Message&& req,
+                               Context::FrameWriter frame_writer, ResponseCallback done) {
+    std::vector<int> response_fds;
+    if (req.message_type == MetricsMessageType || !server->async_message_handler) {
+        std::string response_content =
+            InvokeMessageHandler(server, req, response_fds, frame_writer);
+        CloseFds(req.fds);
+        done(response_content, response_fds);
+        return;
+    }
+
+    // the handler may refer to both until its future completes
+    struct Call {
+        Call(const std::shared_ptr<IpcServer>& server, Message&& req,
+             Context::FrameWriter&& frame_writer)
+            : ctx(server, std::move(frame_writer)), req(std::move(req)) {}
+        ~Call() { CloseFds(req.fds); }
+
+        Context ctx;
+        Message req;
+    };
+
+    auto start = Clock::now();
+    MessageTypeMetrics& metrics = StartHandlerMetrics(server, req, start);
+    auto call = std::make_shared<Call>(server, std::move(req), std::move(frame_writer));
+
+    Future<std::string> response;
+    try {
+        response = server->async_message_handler(call->ctx, call->req);
+    } catch (...) {
+        response = make_exceptional_future<std::string>(std::current_exception());
+    }
+
+    // metrics belongs to the server, which a pending response keeps alive
+    response.on_ready([server, call, &metrics, start,
+                       done = std::move(done)](Future<std::string> ready) mutable {
+        std::string response_content;
+        bool failed = false;
+        try {
+            response_content = ready.get();
+        } catch (...) {
+            failed = true;
+        }
+        std::vector<int> response_fds;
+        FinishHandler(metrics, start, call->ctx, failed, response_content, response_fds);
+        call.reset();
+        done(response_content, response_fds);
+    });
+}
+
+static thread_local std::string spare_response_buffer;
+
+std::string AcquireResponseBuffer() {
+    std::string buffer = std::move(spare_response_buffer);
+    spare_response_buffer = std::string();
+    buffer.clear();
+    return buffer;
+}
+
+void RecycleResponseBuffer(std::string&& buffer) {
+    if (buffer.capacity() > MaxRecycledBufferSize ||
+        buffer.capacity() <= spare_response_buffer.capacity()) {
+        return;
+    }
+    spare_response_buffer = std::move(buffer);
+}
+
+bool Context::Write(const std::string& partial) {
+    if (frame_writer_) {
+        return frame_writer_(false, partial);
+    }
+
+    std::lock_guard<std::mutex> guard(buffered_mutex_);
+    buffered_.append(partial);
+    return true;
+}
+
+bool Context::Progress(const std::string& progress) {
+    return frame_writer_ ? frame_writer_(true, progress) : true;
+}
 
 Session::Session(std::weak_ptr<IpcServer> server, MessageTunnel tunnel)
     : server_(server), tunnel_(tunnel) {}
@@ -143,8 +437,12 @@ Session::Session(std::weak_ptr<IpcServer> server, MessageTunnel tunnel)
 void Session::HandleMessage() {
     while (true) {
         MessageHeader header;
-        if (!ReadBytesFromTunnel(tunnel_, reinterpret_cast<char*>(&header),
-                                 sizeof(MessageHeader))) {
+        std::vector<int>* received_fds = nullptr;
+#ifndef _WIN32
+        received_fds = &received_fds_;
+#endif
+        if (!ReadBytesFromTunnel(tunnel_, reinterpret_cast<char*>(&header), sizeof(MessageHeader),
+                                 received_fds)) {
             Close();
             return;
         }
@@ -153,39 +451,57 @@ void Session::HandleMessage() {
         req_message.request_id = header.request_id;
         req_message.message_type = header.message_type;
 
-        if (!ReadStringFromTunnel(tunnel_, req_message.content, header.body_size)) {
+        if (!TakeFds(received_fds_, header.fd_count, req_message.fds) ||
+            !ReadFrameBody(tunnel_, header,
+                           shared_memory_ ? &shared_memory_->client_to_server() : nullptr,
+                           req_message.content)) {
+            CloseFds(req_message.fds);
             Close();
             return;
         }
+        req_message.received_at = std::chrono::steady_clock::now();
+
+        if (header.flags & FlagSharedMemoryHandshake) {
+            if (!AcceptSharedMemory(header, req_message.fds)) {
+                Close();
+                return;
+            }
+            continue;
+        }
 
         auto server = server_.lock();
         if (!server) {
+            CloseFds(req_message.fds);
             Close();
             return;
         }
-        Context ctx(server);
-
-        std::string response_content;
-        if (server->message_handler) {
-            try {
-                response_content = server->message_handler(ctx, req_message);
-            } catch (...) {
-                response_content.clear();
-            }
-        }
 
         MessageHeader resp_header;
         resp_header.request_id = req_message.request_id;
         resp_header.message_type = req_message.message_type;
-        resp_header.body_size = response_content.size();
 
-        if (!WriteBytesToTunnel(tunnel_, reinterpret_cast<const char*>(&resp_header),
-                                sizeof(MessageHeader))) {
-            Close();
-            return;
+        Context::FrameWriter frame_writer;
+        if (header.flags & FlagStreaming) {
+            frame_writer = [this, resp_header, request_flags = header.flags](
+                               bool progress, const std::string& body) {
+                MessageHeader partial_header = resp_header;
+                partial_header.flags = PartialFrameFlags(request_flags, progress);
+                return WriteResponse(partial_header, body);
+            };
         }
 
-        if (!WriteStringToTunnel(tunnel_, response_content)) {
+        std::vector<int> response_fds;
+        std::string response_content =
+            InvokeMessageHandler(server, req_message, response_fds, frame_writer);
+        CloseFds(req_message.fds);
+
+        // pipelined requests are accepted but answered in order on a blocking session
+        resp_header.flags = header.flags & FlagPipelined;
+
+        bool ok = WriteResponse(resp_header, response_content, response_fds);
+        CloseFds(response_fds);
+        RecycleResponseBuffer(std::move(response_content));
+        if (!ok) {
             Close();
             return;
         }
@@ -193,8 +509,32 @@ void Session::HandleMessage() {
     Close();
 }
 
+bool Session::WriteResponse(MessageHeader header, const std::string& body,
+                            const std::vector<int>& fds) {
+    std::lock_guard<std::mutex> guard(write_mutex_);
+    return WriteFrame(tunnel_, header, body,
+                      shared_memory_ ? &shared_memory_->server_to_client() : nullptr, fds);
+}
+
+bool Session::AcceptSharedMemory(const MessageHeader& header, std::vector<int>& fds) {
+    if (fds.size() == 1 && !shared_memory_) {
+        shared_memory_ = SharedMemoryChannel::Attach(fds[0]);
+        fds.clear();
+    }
+    CloseFds(fds);
+
+    MessageHeader resp_header;
+    resp_header.request_id = header.request_id;
+    resp_header.message_type = header.message_type;
+    resp_header.flags = FlagSharedMemoryHandshake;
+    std::lock_guard<std::mutex> guard(write_mutex_);
+    return WriteFrame(tunnel_, resp_header, shared_memory_ ? "ok" : "", nullptr);
+}
+
 void Session::Close() {
     CloseTunnel(tunnel_);
+    CloseFds(received_fds_);
+    shared_memory_.reset();
 
     auto server = server_.lock();
     if (server && server->client_disconnect_handler) {
@@ -221,10 +561,38 @@ void Context::Shutdown() {
 }
 
 IpcServer::IpcServer(const std::string& token)
-    : ipc_token(token), global_thread_pool_(&ThreadPool::GlobalPool()) {}
+    : ipc_token(token), thread_pool_(nullptr) {}
+
+std::string IpcServer::MetricsSnapshot() {
+    std::vector<ThreadPool*> pools;
+    if (thread_pool_) {
+        pools.push_back(thread_pool_);
+    }
+    for (const PriorityClass& cls : priority_classes) {
+        if (cls.pool && std::find(pools.begin(), pools.end(), cls.pool) == pools.end()) {
+            pools.push_back(cls.pool);
+        }
+    }
+
+    std::string pool_stats;
+    for (ThreadPool* pool : pools) {
+        PoolStats stats = pool->stats();
+        if (stats.workers.empty()) {
+            continue;
+        }
+        pool_stats += pool_stats.empty() ? "" : ",";
+        pool_stats += to_json(stats);
+    }
+
+    // {"message_types":[...]} -> {"message_types":[...],"pools":[...]}
+    std::string snapshot = metrics_.Snapshot();
+    snapshot.insert(snapshot.size() - 1, ",\"pools\":[" + pool_stats + "]");
+    return snapshot;
+}
 
 bool IpcServer::Run() {
     is_running_ = true;
+    thread_pool_ = thread_pool ? thread_pool : &ThreadPool::GlobalPool();
 
 #ifdef _WIN32
     auto named_pipd_path = GetNamedPipedFromIpcToken(ipc_token);
@@ -253,7 +621,7 @@ bool IpcServer::Run() {
             ::CloseHandle(handle_);
             break;
         }
-        global_thread_pool_->add_task([self = shared_from_this(), handle = this->handle_] {
+        thread_pool_->add_task([self = shared_from_this(), handle = this->handle_] {
             Session session(self, handle);
             session.HandleMessage();
         });
@@ -290,6 +658,21 @@ bool IpcServer::Run() {
         return false;
     }
 
+#ifdef __linux__
+    if (serve_mode == ServeMode::Reactor) {
+        auto scheduler = std::make_shared<Scheduler>(thread_pool_, priority_classes,
+                                                     message_type_priority, default_priority);
+        auto reactor = std::make_shared<Reactor>(weak_from_this(), scheduler, io_thread_count);
+        std::atomic_store(&reactor_, reactor);
+        bool ok = is_running_ && reactor->Serve(fd);
+        std::atomic_store(&reactor_, std::shared_ptr<Reactor>());
+
+        ::close(fd);
+        fd = -1;
+        return ok;
+    }
+#endif
+
     while (is_running_) {
         bool ok = AcceptRequest();
         if (!ok) {
@@ -298,6 +681,7 @@ bool IpcServer::Run() {
     }
 
     ::close(fd);
+    fd = -1;
 #endif
 
     return true;
@@ -309,7 +693,7 @@ bool IpcServer::AcceptRequest() {
     if (socket < 0) {
         return false;
     }
-    global_thread_pool_->add_task([self = shared_from_this(), socket] {
+    thread_pool_->add_task([self = shared_from_this(), socket] {
         Session session(self, socket);
         session.HandleMessage();
     });
@@ -326,10 +710,17 @@ void IpcServer::HandleRequestStandalone(int socket) {
 
 void IpcServer::Shutdown() {
     is_running_ = false;
+    if (auto reactor = std::atomic_load(&reactor_)) {
+        // Run() owns the listening socket in reactor mode and closes it on exit
+        reactor->Stop();
+        return;
+    }
 #ifdef _WIN32
     ::CloseHandle(handle_);
 #else
-    ::close(fd);
+    // Run() resets fd once it has closed the socket itself
+    if (fd >= 0)
+        ::close(fd);
 #endif
 }
 
@@ -357,6 +748,7 @@ bool IpcClient::Connect(const std::string& token) {
     }
 
     struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
     addr.sun_family = AF_UNIX;
     strncpy(addr.sun_path, named_socket_path.c_str(), named_socket_path.size());
 
@@ -366,35 +758,336 @@ bool IpcClient::Connect(const std::string& token) {
     }
 #endif
 
+    connected_ = true;
     return true;
 }
 
-bool IpcClient::Send(std::int32_t message_type, const std::string& content, std::string& resp) {
+bool IpcClient::EnableSharedMemory(std::size_t ring_capacity) {
+#ifdef __linux__
+    if (!connected_ || receiving_ || shared_memory_) {
+        return false;
+    }
+
+    auto channel = SharedMemoryChannel::Create(ring_capacity);
+    if (!channel) {
+        return false;
+    }
+
     MessageHeader header;
     header.request_id = req_id_counter++;
-    header.message_type = message_type;
-    header.body_size = content.size();
+    header.message_type = ControlMessageType;
+    header.flags = FlagSharedMemoryHandshake;
 
-    if (!WriteBytesToTunnel(tunnel_, reinterpret_cast<const char*>(&header),
-                            sizeof(MessageHeader))) {
+    std::lock_guard<std::mutex> guard(write_mutex_);
+    if (!WriteFrame(tunnel_, header, "", nullptr, {channel->fd()})) {
         return false;
     }
 
-    if (!WriteStringToTunnel(tunnel_, content)) {
+    MessageHeader resp_header;
+    std::string resp;
+    if (!ReadBytesFromTunnel(tunnel_, reinterpret_cast<char*>(&resp_header),
+                             sizeof(MessageHeader)) ||
+        !ReadFrameBody(tunnel_, resp_header, nullptr, resp)) {
         return false;
     }
 
+    // servers without shared-memory support answer with something else, the
+    // session then simply stays on the socket
+    if (resp_header.request_id != header.request_id ||
+        !(resp_header.flags & FlagSharedMemoryHandshake) || resp != "ok") {
+        return false;
+    }
+
+    shared_memory_ = std::move(channel);
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool IpcClient::Send(std::int32_t message_type, const std::string& content, std::string& resp) {
+    if (receiving_) {
+        // the receiver thread owns the read side of the tunnel
+        try {
+            resp = SendAsync(message_type, content).get();
+            return true;
+        } catch (std::exception&) {
+            return false;
+        }
+    }
+
+    std::vector<int> resp_fds;
+    bool ok = Exchange(message_type, content, {}, resp, resp_fds);
+    CloseFds(resp_fds);
+    return ok;
+}
+
+bool IpcClient::Send(const Message& req, Message& resp) {
+    if (receiving_) {
+        return false;
+    }
+
+    resp.message_type = req.message_type;
+    return Exchange(req.message_type, req.content, req.fds, resp.content, resp.fds);
+}
+
+bool IpcClient::Exchange(std::int32_t message_type, const std::string& content,
+                         const std::vector<int>& fds, std::string& resp,
+                         std::vector<int>& resp_fds) {
+    MessageHeader header;
+    header.request_id = req_id_counter++;
+    header.message_type = message_type;
+    header.flags = PriorityFlags();
+
+    {
+        std::lock_guard<std::mutex> guard(write_mutex_);
+        if (!WriteFrame(tunnel_, header, content,
+                        shared_memory_ ? &shared_memory_->client_to_server() : nullptr, fds)) {
+            return false;
+        }
+    }
+
+    std::vector<int> received_fds;
+    std::vector<int>* received_fds_ptr = nullptr;
+#ifndef _WIN32
+    received_fds_ptr = &received_fds;
+#endif
     MessageHeader resp_header;
     if (!ReadBytesFromTunnel(tunnel_, reinterpret_cast<char*>(&resp_header),
-                             sizeof(MessageHeader))) {
+                             sizeof(MessageHeader), received_fds_ptr) ||
+        resp_header.request_id != header.request_id ||
+        !TakeFds(received_fds, resp_header.fd_count, resp_fds)) {
+        CloseFds(received_fds);
         return false;
     }
+    CloseFds(received_fds);
+
+    return ReadFrameBody(tunnel_, resp_header,
+                         shared_memory_ ? &shared_memory_->server_to_client() : nullptr, resp) &&
+           !(resp_header.flags & FlagBusy);
+}
+
+std::uint32_t IpcClient::PriorityFlags() const {
+    int priority = priority_;
+    if (priority < 0) {
+        return 0;
+    }
+    return (static_cast<std::uint32_t>(std::min(priority, 254) + 1) << PriorityShift) &
+           PriorityMask;
+}
+
+bool IpcClient::SendAsync(std::int32_t message_type, const std::string& content,
+                          ResponseCallback callback) {
+    return SendPipelined(message_type, content, 0,
+                         [callback = std::move(callback)](bool ok, std::uint32_t flags,
+                                                          std::string& body) {
+                             callback(ok && !(flags & FlagBusy), body);
+                         });
+}
+
+bool IpcClient::SendPipelined(std::int32_t message_type, const std::string& content,
+                              std::uint32_t flags, FrameCallback callback) {
+    MessageHeader header;
+    header.request_id = req_id_counter++;
+    header.message_type = message_type;
+    header.flags = FlagPipelined | PriorityFlags() | flags;
+
+#ifdef _WIN32
+    // reads and writes on a synchronous pipe handle are serialized by the system,
+    // so there is no receiver thread and requests complete one by one
+    std::lock_guard<std::mutex> guard(write_mutex_);
+    if (!WriteFrame(tunnel_, header, content, nullptr)) {
+        return false;
+    }
+    while (true) {
+        MessageHeader resp_header;
+        std::string body;
+        if (!ReadBytesFromTunnel(tunnel_, reinterpret_cast<char*>(&resp_header),
+                                 sizeof(MessageHeader)) ||
+            !ReadFrameBody(tunnel_, resp_header, nullptr, body)) {
+            callback(false, 0, body);
+            return true;
+        }
+        callback(true, resp_header.flags, body);
+        if (!(resp_header.flags & FlagPartial)) {
+            return true;
+        }
+    }
+#else
+    {
+        std::lock_guard<std::mutex> guard(pending_mutex_);
+        if (!connected_ || broken_) {
+            return false;
+        }
+        pending_[header.request_id] = std::move(callback);
+        if (!receiving_) {
+            receiving_ = true;
+            receiver_ = std::thread([this] { ReceiveResponses(); });
+        }
+    }
 
-    if (resp_header.request_id != header.request_id) {
+    bool ok;
+    {
+        std::lock_guard<std::mutex> guard(write_mutex_);
+        ok = WriteFrame(tunnel_, header, content,
+                        shared_memory_ ? &shared_memory_->client_to_server() : nullptr);
+    }
+
+    if (!ok) {
+        // unless the receiver has already failed it, the callback is not invoked
+        std::lock_guard<std::mutex> guard(pending_mutex_);
+        return pending_.erase(header.request_id) == 0;
+    }
+    return true;
+#endif
+}
+
+std::future<std::string> IpcClient::SendAsync(std::int32_t message_type,
+                                              const std::string& content) {
+    auto promise = std::make_shared<std::promise<std::string>>();
+    auto future = promise->get_future();
+
+    bool ok = SendPipelined(
+        message_type, content, 0, [promise](bool ok, std::uint32_t flags, std::string& resp) {
+            if (ok && (flags & FlagBusy)) {
+                promise->set_exception(std::make_exception_ptr(ServerBusyError()));
+            } else if (ok) {
+                promise->set_value(std::move(resp));
+            } else {
+                promise->set_exception(
+                    std::make_exception_ptr(std::runtime_error("easyipc: connection lost")));
+            }
+        });
+    if (!ok) {
+        promise->set_exception(
+            std::make_exception_ptr(std::runtime_error("easyipc: failed to send request")));
+    }
+    return future;
+}
+
+static FrameKind FrameKindFromFlags(std::uint32_t flags) {
+    if (!(flags & FlagPartial)) {
+        return FrameKind::Final;
+    }
+    return (flags & FlagProgress) ? FrameKind::Progress : FrameKind::Partial;
+}
+
+bool IpcClient::SendStream(std::int32_t message_type, const std::string& content,
+                           StreamCallback callback) {
+    return SendPipelined(
+        message_type, content, FlagStreaming,
+        [callback = std::move(callback)](bool ok, std::uint32_t flags, std::string& body) {
+            callback(ok && !(flags & FlagBusy), FrameKindFromFlags(flags), body);
+        });
+}
+
+std::shared_ptr<ResponseStream> IpcClient::SendStream(std::int32_t message_type,
+                                                      const std::string& content) {
+    auto stream = std::make_shared<ResponseStream>();
+    bool ok = SendStream(message_type, content,
+                         [stream](bool ok, FrameKind kind, std::string& body) {
+                             stream->Push(ok, kind, body);
+                         });
+    return ok ? stream : nullptr;
+}
+
+void ResponseStream::Push(bool ok, FrameKind kind, std::string& body) {
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        if (ok) {
+            frames_.emplace_back(kind, std::move(body));
+        } else {
+            failed_ = true;
+        }
+    }
+    cv_.notify_one();
+}
+
+bool ResponseStream::Next(FrameKind& kind, std::string& body) {
+    std::unique_lock<std::mutex> lk(mutex_);
+    cv_.wait(lk, [this] { return finished_ || failed_ || !frames_.empty(); });
+    if (frames_.empty()) {
         return false;
     }
 
-    return ReadStringFromTunnel(tunnel_, resp, resp_header.body_size);
+    kind = frames_.front().first;
+    body = std::move(frames_.front().second);
+    frames_.pop_front();
+    finished_ = kind == FrameKind::Final;
+    return true;
+}
+
+bool ResponseStream::failed() const {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return failed_;
+}
+
+void IpcClient::ReceiveResponses() {
+    while (true) {
+        // descriptors attached to pipelined responses are not surfaced, close them
+        std::vector<int> received_fds;
+        MessageHeader header;
+        bool ok = ReadBytesFromTunnel(tunnel_, reinterpret_cast<char*>(&header),
+                                      sizeof(MessageHeader), &received_fds);
+        CloseFds(received_fds);
+        if (!ok) {
+            break;
+        }
+
+        std::string resp;
+        if (!ReadFrameBody(tunnel_, header,
+                           shared_memory_ ? &shared_memory_->server_to_client() : nullptr, resp)) {
+            break;
+        }
+
+        FrameCallback callback;
+        {
+            std::lock_guard<std::mutex> guard(pending_mutex_);
+            auto it = pending_.find(header.request_id);
+            if (it == pending_.end()) {
+                continue;
+            }
+            if (header.flags & FlagPartial) {
+                // more frames follow, keep the request registered
+                callback = it->second;
+            } else {
+                callback = std::move(it->second);
+                pending_.erase(it);
+            }
+        }
+        callback(true, header.flags, resp);
+    }
+
+    std::unordered_map<std::int64_t, FrameCallback> failed;
+    {
+        std::lock_guard<std::mutex> guard(pending_mutex_);
+        broken_ = true;
+        failed.swap(pending_);
+    }
+    for (auto& item : failed) {
+        std::string empty;
+        item.second(false, 0, empty);
+    }
+}
+
+void IpcClient::Close() {
+    {
+        std::lock_guard<std::mutex> guard(pending_mutex_);
+        if (!connected_) {
+            return;
+        }
+        connected_ = false;
+    }
+
+#ifndef _WIN32
+    // wakes up the receiver thread
+    ::shutdown(tunnel_, SHUT_RDWR);
+#endif
+    if (receiver_.joinable()) {
+        receiver_.join();
+    }
+    CloseTunnel(tunnel_);
+    shared_memory_.reset();
 }
 
 }  // namespace EasyIpc
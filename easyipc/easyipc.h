@@ -1,12 +1,22 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <functional>
+#include <future>
 #include <memory>
+#include <mutex>
+#include <stdexcept>
 #include <string>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include "ThreadPool/ThreadPool.h"
+#include "metrics.h"
+#include "shm.h"
 
 #ifdef _WIN32
 #include <Windows.h>
@@ -17,23 +27,100 @@ typedef int MessageTunnel;
 
 namespace EasyIpc {
 
+// Answered by IpcServer itself with MetricsSnapshot(), the handler never sees it.
+// Services number their own message types from 0.
+static constexpr std::int32_t MetricsMessageType = -2;
+
 class Message {
    public:
     std::int64_t request_id = -1;
     std::int32_t message_type = -1;
     std::string content;
+    // File descriptors passed along with the message (SCM_RIGHTS, not on Windows).
+    // On the server they are closed once the handler returns, dup() to keep one.
+    std::vector<int> fds;
+    // when the server finished reading the request
+    std::chrono::steady_clock::time_point received_at;
+};
+
+// Kind of a response frame. A streamed response is any number of Partial and
+// Progress frames followed by exactly one Final frame.
+enum class FrameKind {
+    Partial,
+    Progress,
+    Final,
 };
 
 class IpcServer;
+class MessageHeader;
+
+// Frames of one streamed response in the order the server wrote them.
+class ResponseStream {
+   public:
+    // Blocks until the next frame arrives. Returns false once the Final frame has
+    // been returned, or when the connection broke before it (failed() is then true).
+    bool Next(FrameKind& kind, std::string& body);
+
+    bool failed() const;
+
+   private:
+    friend class IpcClient;
+    void Push(bool ok, FrameKind kind, std::string& body);
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::pair<FrameKind, std::string>> frames_;
+    bool finished_ = false;
+    bool failed_ = false;
+};
 
 class Context {
    public:
-    Context(std::weak_ptr<IpcServer> server) : server_(server) {}
+    // Writes one intermediate frame of a streamed response, progress == true for a
+    // progress report. Returns false if the frame could not be sent.
+    using FrameWriter = std::function<bool(bool progress, const std::string& body)>;
+
+    Context(std::weak_ptr<IpcServer> server, FrameWriter frame_writer = nullptr)
+        : server_(server), frame_writer_(std::move(frame_writer)) {}
 
     void Shutdown();
 
+    // Send a partial result ahead of the handler's return value. Clients that did
+    // not ask for a stream receive all partial results concatenated in front of the
+    // final response instead, so a handler emitting serialized messages of the
+    // response type produces the same merged message for them. Thread-safe, but must
+    // not be called after the handler has returned (an async handler: after its
+    // future completed).
+    bool Write(const std::string& partial);
+
+    // Report progress; dropped for clients that did not ask for a stream.
+    bool Progress(const std::string& progress);
+
+    // true if the client reads the response as a stream
+    bool streaming() const { return frame_writer_ != nullptr; }
+
+    // Send fd along with the response. Ownership passes to easyipc, which closes
+    // it after sending.
+    void AttachFd(int fd) { response_fds_.push_back(fd); }
+
+    std::vector<int>& response_fds() { return response_fds_; }
+
+    // partial results buffered for a client that did not ask for a stream
+    std::string TakeBuffered() { return std::move(buffered_); }
+
+    // Count the request as an error in the server's metrics although the handler
+    // returned normally, e.g. when it answers with an error response.
+    void MarkFailed() { failed_ = true; }
+    bool failed() const { return failed_; }
+
    private:
     std::weak_ptr<IpcServer> server_;
+    std::vector<int> response_fds_;
+
+    FrameWriter frame_writer_;
+    std::mutex buffered_mutex_;
+    std::string buffered_;
+    bool failed_ = false;
 };
 
 class Session {
@@ -45,13 +132,59 @@ class Session {
     void Close();
 
    private:
+    bool AcceptSharedMemory(const MessageHeader& header, std::vector<int>& fds);
+    bool WriteResponse(MessageHeader header, const std::string& body,
+                       const std::vector<int>& fds = {});
+
     std::weak_ptr<IpcServer> server_;
     MessageTunnel tunnel_;
+    // handlers may write partial results from other threads
+    std::mutex write_mutex_;
+
+    // descriptors received ahead of the frames that claim them
+    std::vector<int> received_fds_;
+    std::shared_ptr<SharedMemoryChannel> shared_memory_;
 };
 
 using MessageHandler = std::function<std::string(Context& context, const Message& req)>;
+// A handler that returns before its response is ready, e.g. a coroutine or a chain
+// of Future::then stages. context and req stay valid until the future completes.
+using AsyncMessageHandler =
+    std::function<Future<std::string>(Context& context, const Message& req)>;
+
+// Per-thread spare buffer for response bodies. A handler may build its response in
+// the string returned by AcquireResponseBuffer(); once the response has been sent the
+// server recycles it, so the next request on the same worker reuses its capacity.
+std::string AcquireResponseBuffer();
+void RecycleResponseBuffer(std::string&& buffer);
 using ClientDisconnectHandler = std::function<void(Context& context, const Session& session)>;
 
+enum class ServeMode {
+    // every connection occupies a thread pool worker for its whole life
+    Blocking,
+    // connections are multiplexed on a few epoll threads, only complete messages
+    // are dispatched to the thread pool (Linux only, falls back to Blocking elsewhere)
+    Reactor,
+};
+
+// Limits of one priority class. 0 means unlimited.
+struct PriorityClass {
+    // requests of this class handled at the same time
+    std::size_t max_concurrency = 0;
+    // requests of this class waiting for a worker; more are rejected as busy
+    std::size_t max_queued = 0;
+    // pool running the handlers of this class, IpcServer::thread_pool when null
+    ThreadPool* pool = nullptr;
+};
+
+// A request the server rejected because its priority class queue was full.
+class ServerBusyError : public std::runtime_error {
+   public:
+    ServerBusyError() : std::runtime_error("easyipc: server busy") {}
+};
+
+class Reactor;
+
 class IpcServer : public std::enable_shared_from_this<IpcServer> {
    public:
     explicit IpcServer(const std::string& token);
@@ -67,15 +200,45 @@ class IpcServer : public std::enable_shared_from_this<IpcServer> {
     ~IpcServer() { Shutdown(); }
 
     MessageHandler message_handler;
+    // Used instead of message_handler when set. In Reactor mode no worker waits for
+    // the future and the response is sent when it completes; the priority class
+    // limits then only cover the handler call itself, not the stages it starts.
+    // Blocking sessions wait for it.
+    AsyncMessageHandler async_message_handler;
     ClientDisconnectHandler client_disconnect_handler;
 
+    // must be set before Run()
+    ServeMode serve_mode = ServeMode::Blocking;
+    std::size_t io_thread_count = 1;
+    // Pool running the handlers, and the sessions in Blocking mode. Null means
+    // ThreadPool::GlobalPool(). Must be set before Run().
+    ThreadPool* thread_pool = nullptr;
+
+    // Priority classes, index 0 is the most urgent. Waiting requests are handed to
+    // the thread pool most urgent class first. Empty means one class without limits.
+    // Only applied in Reactor mode, must be set before Run().
+    std::vector<PriorityClass> priority_classes;
+    // class of each message type, used unless the client asks for one per request
+    // (IpcClient::SetPriority)
+    std::unordered_map<std::int32_t, std::size_t> message_type_priority;
+    std::size_t default_priority = 0;
+
+    // per message type timings and sizes, also served as MetricsMessageType
+    ServerMetrics& metrics() { return metrics_; }
+    // ServerMetrics::Snapshot() plus a "pools" array with the stats of the pools
+    // running this server's handlers that have instrumentation enabled
+    // (ThreadPool::enable_instrumentation)
+    std::string MetricsSnapshot();
+
    private:
     bool AcceptRequest();
 
-    ThreadPool* global_thread_pool_;
+    std::string ipc_token;
+    ThreadPool* thread_pool_;
 
     std::atomic<bool> is_running_;
-    std::string ipc_token;
+    std::shared_ptr<Reactor> reactor_;
+    ServerMetrics metrics_;
 #ifdef WIN32
     HANDLE handle_;
 
@@ -87,6 +250,14 @@ class IpcServer : public std::enable_shared_from_this<IpcServer> {
 
 class IpcClient {
    public:
+    // Invoked on the client's receiver thread once the response arrives, or with
+    // ok == false when the connection breaks first or the server rejected the request
+    // as busy. Must not wait for other responses.
+    using ResponseCallback = std::function<void(bool ok, std::string& resp)>;
+    // Like ResponseCallback, invoked once per frame of a streamed response. The
+    // request is complete after the Final frame or a call with ok == false.
+    using StreamCallback = std::function<void(bool ok, FrameKind kind, std::string& body)>;
+
     IpcClient() = default;
     IpcClient(const IpcClient&) = delete;
     explicit IpcClient(IpcClient&&) = delete;
@@ -94,17 +265,79 @@ class IpcClient {
     IpcClient& operator=(const IpcClient&) = delete;
     IpcClient& operator=(IpcClient&&) = delete;
 
-    ~IpcClient() = default;
+    ~IpcClient() { Close(); }
 
     bool Connect(const std::string& token);
 
+    // Ask the server to handle the following requests in this priority class
+    // (IpcServer::priority_classes), -1 to leave it to the server.
+    void SetPriority(int priority_class) { priority_ = priority_class; }
+
+    // Negotiate a shared-memory channel for this session (Linux only). Afterwards
+    // payloads of at least SharedMemoryThreshold bytes travel through memfd-backed
+    // rings instead of the socket. Must be called before the first SendAsync.
+    // Returns false and keeps using the socket if the server does not support it.
+    bool EnableSharedMemory(std::size_t ring_capacity = DefaultRingCapacity);
+
+    // Returns false on failure, including when the server rejected the request as busy.
     bool Send(std::int32_t message_type, const std::string& content, std::string& resp);
 
+    // Like Send, but req.fds are passed to the server (the caller keeps owning them)
+    // and descriptors attached to the response are returned in resp.fds, owned by
+    // the caller. Not available once SendAsync has been used.
+    bool Send(const Message& req, Message& resp);
+
+    // Pipelined send: returns as soon as the request is written, any number of
+    // requests may be in flight and the server answers them in any order.
+    // Returns false (and never calls the callback) if the request could not be sent.
+    bool SendAsync(std::int32_t message_type, const std::string& content,
+                   ResponseCallback callback);
+
+    // The future throws std::runtime_error if the request fails, ServerBusyError if
+    // the server rejected it.
+    std::future<std::string> SendAsync(std::int32_t message_type, const std::string& content);
+
+    // Pipelined send that asks the server to stream the response: partial results
+    // and progress reports arrive as separate frames before the final one.
+    bool SendStream(std::int32_t message_type, const std::string& content,
+                    StreamCallback callback);
+
+    // Iterate the frames with ResponseStream::Next(). Returns nullptr if the
+    // request could not be sent.
+    std::shared_ptr<ResponseStream> SendStream(std::int32_t message_type,
+                                               const std::string& content);
+
+    void Close();
+
    private:
+    // invoked once per response frame with the frame's header flags
+    using FrameCallback = std::function<void(bool ok, std::uint32_t flags, std::string& body)>;
+
+    bool SendPipelined(std::int32_t message_type, const std::string& content,
+                       std::uint32_t flags, FrameCallback callback);
+    bool Exchange(std::int32_t message_type, const std::string& content,
+                  const std::vector<int>& fds, std::string& resp, std::vector<int>& resp_fds);
+    void ReceiveResponses();
+
+    std::uint32_t PriorityFlags() const;
+
     std::string ipc_token;
-    std::int64_t req_id_counter = 0;
+    std::atomic<std::int64_t> req_id_counter{0};
+    std::atomic<int> priority_{-1};
 
     MessageTunnel tunnel_;
+    bool connected_ = false;
+
+    std::mutex write_mutex_;
+
+    // in-flight pipelined requests, completed by receiver_
+    std::mutex pending_mutex_;
+    std::unordered_map<std::int64_t, FrameCallback> pending_;
+    std::atomic<bool> receiving_{false};
+    bool broken_ = false;
+    std::thread receiver_;
+
+    std::unique_ptr<SharedMemoryChannel> shared_memory_;
 };
 
 }  // namespace EasyIpc
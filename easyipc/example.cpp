@@ -5,6 +5,7 @@
 #include <iostream>
 #include <cstring>
 #include <memory>
+#include <vector>
 #include "easyipc.h"
 
 using EasyIpc::IpcServer;
@@ -20,7 +21,9 @@ int main(int argc, char* argv[]) {
     auto server = std::make_shared<IpcServer>("test-ipc");
     server->message_handler = [](EasyIpc::Context& ctx, const EasyIpc::Message& msg){
         std::cout << "server receive: " << msg.content << std::endl;
-        return "haha";
+        // a plain client receives "haha", a streaming one "ha" twice
+        ctx.Write("ha");
+        return "ha";
     };
 	server->client_disconnect_handler = [](EasyIpc::Context& ctx, const EasyIpc::Session& session) {
 		std::cout << "client disconnect" << std::endl;
@@ -51,5 +54,22 @@ int client_main(int argc, char* argv[]) {
         std::cout << "client receive: " << resp << std::endl;
     }
 
+    // pipelined: all requests are in flight before the first response is read
+    std::vector<std::future<std::string>> responses;
+    for (int i = 0; i < 10; i++) {
+        responses.push_back(client->SendAsync(0, "33"));
+    }
+    for (auto& resp : responses) {
+        std::cout << "client receive: " << resp.get() << std::endl;
+    }
+
+    // streamed: partial results are handed out as the server writes them
+    auto stream = client->SendStream(0, "44");
+    EasyIpc::FrameKind kind;
+    std::string body;
+    while (stream && stream->Next(kind, body)) {
+        std::cout << "client receive frame: " << body << std::endl;
+    }
+
     return 0;
 }
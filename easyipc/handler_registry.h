@@ -0,0 +1,133 @@
+//
+// Typed dispatch for services speaking protobuf over easyipc. Each message type gets
+// a handler taking the parsed request and filling the response; parsing, arena
+// allocation and serialization are done here once instead of in every service.
+//
+
+#pragma once
+
+#include <google/protobuf/arena.h>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "easyipc.h"
+
+namespace EasyIpc {
+
+namespace internal {
+
+static constexpr std::size_t ArenaInitialBlockSize = 16 * 1024;
+
+// Arena whose first block is a per-thread buffer, so a typical request does not
+// allocate for its messages at all. A handler that runs nested on the same thread
+// falls back to a heap allocated first block.
+class RequestArena {
+   public:
+    RequestArena() : arena_(Options()) {}
+    RequestArena(const RequestArena&) = delete;
+    RequestArena& operator=(const RequestArena&) = delete;
+
+    ~RequestArena() {
+        if (owns_block_)
+            BlockInUse() = false;
+    }
+
+    google::protobuf::Arena* get() { return &arena_; }
+
+   private:
+    google::protobuf::ArenaOptions Options() {
+        google::protobuf::ArenaOptions options;
+        if (!BlockInUse()) {
+            BlockInUse() = true;
+            owns_block_ = true;
+            options.initial_block = Block();
+            options.initial_block_size = ArenaInitialBlockSize;
+        }
+        return options;
+    }
+
+    static char* Block() {
+        alignas(16) static thread_local char block[ArenaInitialBlockSize];
+        return block;
+    }
+
+    static bool& BlockInUse() {
+        static thread_local bool in_use = false;
+        return in_use;
+    }
+
+    bool owns_block_ = false;
+    google::protobuf::Arena arena_;
+};
+
+// Serialize into the calling thread's recycled response buffer.
+template <typename Resp>
+std::string SerializeResponse(const Resp& resp) {
+    std::string body = AcquireResponseBuffer();
+    std::size_t size = resp.ByteSizeLong();
+    if (size > 0) {
+        body.resize(size);
+        resp.SerializeWithCachedSizesToArray(reinterpret_cast<std::uint8_t*>(&body[0]));
+    }
+    return body;
+}
+
+}  // namespace internal
+
+class HandlerRegistry {
+   public:
+    // Returns false to answer with an empty body, the service's error response; the
+    // request is counted as an error in the server's metrics.
+    template <typename Req, typename Resp>
+    using Handler =
+        std::function<bool(Context& ctx, const Message& msg, const Req& req, Resp& resp)>;
+
+    // The request is parsed straight from the received body; the messages live in an
+    // arena for the duration of the call.
+    template <typename Req, typename Resp>
+    void Register(std::int32_t message_type, Handler<Req, Resp> handler) {
+        handlers_[message_type] = [handler = std::move(handler)](Context& ctx,
+                                                                 const Message& msg) {
+            internal::RequestArena arena;
+            Req* req = google::protobuf::Arena::Create<Req>(arena.get());
+            if (!req->ParseFromArray(msg.content.data(), static_cast<int>(msg.content.size()))) {
+                ctx.MarkFailed();
+                return std::string();
+            }
+
+            Resp* resp = google::protobuf::Arena::Create<Resp>(arena.get());
+            if (!handler(ctx, msg, *req, *resp)) {
+                ctx.MarkFailed();
+                return std::string();
+            }
+            return internal::SerializeResponse(*resp);
+        };
+    }
+
+    // For message types whose body is not a protobuf message.
+    void RegisterRaw(std::int32_t message_type, MessageHandler handler) {
+        handlers_[message_type] = std::move(handler);
+    }
+
+    bool Contains(std::int32_t message_type) const {
+        return handlers_.find(message_type) != handlers_.end();
+    }
+
+    // Usable as IpcServer::message_handler. Unknown message types get an empty body.
+    std::string Dispatch(Context& ctx, const Message& msg) const {
+        auto it = handlers_.find(msg.message_type);
+        if (it == handlers_.end()) {
+            return "";
+        }
+        return it->second(ctx, msg);
+    }
+
+   private:
+    std::unordered_map<std::int32_t, MessageHandler> handlers_;
+};
+
+}  // namespace EasyIpc
@@ -0,0 +1,92 @@
+//
+// Read-only mapping of a file descriptor received as a message attachment.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <streambuf>
+#include <string_view>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace EasyIpc {
+
+class MappedFd {
+   public:
+    MappedFd() = default;
+    MappedFd(const MappedFd&) = delete;
+    MappedFd& operator=(const MappedFd&) = delete;
+    ~MappedFd() { Unmap(); }
+
+    // Map the whole file behind fd. The descriptor itself is not retained.
+    bool Map(int fd) {
+        Unmap();
+#ifndef _WIN32
+        struct stat st;
+        if (::fstat(fd, &st) != 0 || st.st_size <= 0)
+            return false;
+
+        void* data = ::mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED)
+            return false;
+
+        data_ = static_cast<const char*>(data);
+        size_ = st.st_size;
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    std::string_view bytes() const { return {data_, size_}; }
+    bool empty() const { return size_ == 0; }
+
+   private:
+    void Unmap() {
+#ifndef _WIN32
+        if (data_)
+            ::munmap(const_cast<char*>(data_), size_);
+#endif
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    const char* data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+// std::streambuf over memory that is not owned, for decoders that take a stream.
+class MemoryStreamBuf : public std::streambuf {
+   public:
+    explicit MemoryStreamBuf(std::string_view bytes) {
+        char* begin = const_cast<char*>(bytes.data());
+        setg(begin, begin, begin + bytes.size());
+    }
+
+   protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+                     std::ios_base::openmode which) override {
+        char* target;
+        if (dir == std::ios_base::beg) {
+            target = eback() + off;
+        } else if (dir == std::ios_base::cur) {
+            target = gptr() + off;
+        } else {
+            target = egptr() + off;
+        }
+        if (target < eback() || target > egptr())
+            return pos_type(off_type(-1));
+        setg(eback(), target, egptr());
+        return pos_type(target - eback());
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+};
+
+}  // namespace EasyIpc
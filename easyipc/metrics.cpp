@@ -0,0 +1,71 @@
+#include "metrics.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace EasyIpc {
+
+ServerMetrics::~ServerMetrics() {
+    for (auto& slot : types_) delete slot.load();
+}
+
+MessageTypeMetrics& ServerMetrics::ForType(std::int32_t message_type) {
+    int index = message_type >= 0 && message_type < MaxTrackedTypes ? message_type
+                                                                      : MaxTrackedTypes;
+    MessageTypeMetrics* metrics = types_[index].load(std::memory_order_acquire);
+    if (metrics)
+        return *metrics;
+
+    auto created = new MessageTypeMetrics;
+    if (types_[index].compare_exchange_strong(metrics, created, std::memory_order_acq_rel)) {
+        return *created;
+    }
+    // another thread won the race, metrics now holds its entry
+    delete created;
+    return *metrics;
+}
+
+static void AppendHistogram(std::string& out, const char* name, const Histogram& histogram,
+                            double scale) {
+    char buffer[256];
+    std::snprintf(buffer, sizeof(buffer),
+                  "\"%s\":{\"count\":%llu,\"mean\":%.1f,\"p50\":%.1f,\"p90\":%.1f,"
+                  "\"p99\":%.1f,\"p999\":%.1f,\"max\":%.1f}",
+                  name, static_cast<unsigned long long>(histogram.count()),
+                  histogram.mean() / scale, histogram.value_at_quantile(0.5) / scale,
+                  histogram.value_at_quantile(0.9) / scale,
+                  histogram.value_at_quantile(0.99) / scale,
+                  histogram.value_at_quantile(0.999) / scale, histogram.max() / scale);
+    out += buffer;
+}
+
+std::string ServerMetrics::Snapshot() const {
+    std::string out = "{\"message_types\":[";
+    bool first = true;
+    for (int i = 0; i <= MaxTrackedTypes; i++) {
+        const MessageTypeMetrics* metrics = types_[i].load(std::memory_order_acquire);
+        if (!metrics)
+            continue;
+
+        char buffer[128];
+        std::snprintf(buffer, sizeof(buffer),
+                      "%s{\"message_type\":%d,\"errors\":%llu,\"rejected\":%llu,", first ? "" : ",",
+                      i == MaxTrackedTypes ? -1 : i,
+                      static_cast<unsigned long long>(metrics->errors.load()),
+                      static_cast<unsigned long long>(metrics->rejected.load()));
+        out += buffer;
+        AppendHistogram(out, "queue_wait_us", metrics->queue_wait_ns, 1000.0);
+        out += ",";
+        AppendHistogram(out, "handler_us", metrics->handler_ns, 1000.0);
+        out += ",";
+        AppendHistogram(out, "request_bytes", metrics->request_bytes, 1.0);
+        out += ",";
+        AppendHistogram(out, "response_bytes", metrics->response_bytes, 1.0);
+        out += "}";
+        first = false;
+    }
+    out += "]}";
+    return out;
+}
+
+}  // namespace EasyIpc
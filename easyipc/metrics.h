@@ -0,0 +1,50 @@
+//
+// Per message type request metrics of an IpcServer. Recording is lock-free so it can
+// stay on in production; a snapshot is served through MetricsMessageType.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "ThreadPool/Histogram.h"
+
+namespace EasyIpc {
+
+struct MessageTypeMetrics {
+    // from the request being read off the socket to its handler starting
+    Histogram queue_wait_ns;
+    Histogram handler_ns;
+    Histogram request_bytes;
+    Histogram response_bytes;
+    // handler threw or marked the request failed (Context::MarkFailed), which the
+    // HandlerRegistry does for requests it cannot parse and handlers returning false
+    std::atomic<std::uint64_t> errors{0};
+    // rejected as busy by admission control
+    std::atomic<std::uint64_t> rejected{0};
+};
+
+class ServerMetrics {
+   public:
+    ServerMetrics() = default;
+    ServerMetrics(const ServerMetrics&) = delete;
+    ServerMetrics& operator=(const ServerMetrics&) = delete;
+    ~ServerMetrics();
+
+    // Metrics of one message type, created on first use. Types outside
+    // [0, MaxTrackedTypes) share one entry reported as type -1.
+    MessageTypeMetrics& ForType(std::int32_t message_type);
+
+    // JSON object with one entry per message type seen so far.
+    std::string Snapshot() const;
+
+   private:
+    static constexpr int MaxTrackedTypes = 64;
+
+    // the last slot collects the untracked types
+    std::atomic<MessageTypeMetrics*> types_[MaxTrackedTypes + 1] = {};
+};
+
+}  // namespace EasyIpc
@@ -0,0 +1,99 @@
+//
+// Wire format and helpers shared by the blocking sessions and the reactor.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "easyipc.h"
+
+#ifndef _WIN32
+#include <sys/types.h>
+#include <sys/uio.h>
+#endif
+
+namespace EasyIpc {
+
+static constexpr std::size_t BufferSize = 8192;
+static constexpr std::size_t MaxFdsPerFrame = 16;
+
+// Header flags. The flags and fd_count words used to be struct padding, peers that
+// predate them send zeros there.
+//
+// The request may be answered out of order; the response repeats the flag and is
+// matched by request_id.
+static constexpr std::uint32_t FlagPipelined = 1u << 0;
+// Control frame: the client offers a shared-memory channel, its memfd is the one
+// descriptor passed with the frame. The server answers with the same flag and body
+// "ok" once mapped; anything else means the session stays on the socket.
+static constexpr std::uint32_t FlagSharedMemoryHandshake = 1u << 1;
+// The body is a SharedMemoryDoorbell, the payload itself is in the session's ring.
+static constexpr std::uint32_t FlagSharedMemory = 1u << 2;
+// The client reads the response as a stream of frames (requires FlagPipelined).
+static constexpr std::uint32_t FlagStreaming = 1u << 3;
+// Response frame that is not the last one for its request_id.
+static constexpr std::uint32_t FlagPartial = 1u << 4;
+// With FlagPartial: the body is a progress report rather than a partial result.
+static constexpr std::uint32_t FlagProgress = 1u << 5;
+// Response without body: the request was rejected because its priority class
+// queue is full. The client may retry later.
+static constexpr std::uint32_t FlagBusy = 1u << 6;
+// Bits 8-15 of a request's flags: the priority class the client asks for plus one,
+// 0 to leave it to the server.
+static constexpr int PriorityShift = 8;
+static constexpr std::uint32_t PriorityMask = 0xffu << PriorityShift;
+
+static constexpr std::int32_t ControlMessageType = -1;
+
+class MessageHeader {
+   public:
+    std::int32_t message_type = -1;
+    std::uint32_t flags = 0;
+    std::int64_t request_id = 0;
+    std::uint32_t body_size = 0;
+    // number of file descriptors passed along with this frame (SCM_RIGHTS)
+    std::uint32_t fd_count = 0;
+};
+
+static_assert(sizeof(MessageHeader) == 24, "header layout is part of the wire protocol");
+
+// Runs the server's message handler for one request and returns the response body.
+// Descriptors the handler attached to the response are appended to response_fds.
+// Exceptions thrown by the handler are swallowed and produce an empty response.
+// frame_writer sends intermediate frames if the request asked for a stream, it is
+// nullptr otherwise.
+std::string InvokeMessageHandler(const std::shared_ptr<IpcServer>& server, const Message& req,
+                                 std::vector<int>& response_fds,
+                                 const Context::FrameWriter& frame_writer = nullptr);
+
+// Receives the response body and descriptors of a request, see InvokeAsyncMessageHandler.
+using ResponseCallback =
+    std::function<void(std::string& response_content, std::vector<int>& response_fds)>;
+
+// Like InvokeMessageHandler, but through IpcServer::async_message_handler when set,
+// without waiting for it: done is called once the response is ready, on whichever
+// thread completes it, possibly after this returned. Takes req and closes its
+// descriptors once the handler is done with them.
+void InvokeAsyncMessageHandler(const std::shared_ptr<IpcServer>& server, Message&& req,
+                               Context::FrameWriter frame_writer, ResponseCallback done);
+
+// Header flags of an intermediate response frame.
+inline std::uint32_t PartialFrameFlags(std::uint32_t request_flags, bool progress) {
+    return (request_flags & FlagPipelined) | FlagPartial | (progress ? FlagProgress : 0);
+}
+
+#ifndef _WIN32
+// recvmsg() wrapper, descriptors passed along with the bytes are appended to fds.
+ssize_t ReceiveWithFds(int socket, char* buffer, std::size_t size, int flags,
+                       std::vector<int>& fds);
+
+// sendmsg() wrapper, fds are attached to the first byte sent.
+ssize_t SendWithFds(int socket, const iovec* iov, int iov_count, const std::vector<int>& fds,
+                    int flags);
+#endif
+
+}  // namespace EasyIpc
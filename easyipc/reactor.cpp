@@ -0,0 +1,727 @@
+#include "reactor.h"
+
+#ifdef __linux__
+
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <deque>
+
+#include "easyipc.h"
+#include "protocol.h"
+#include "scheduler.h"
+#include "shm.h"
+
+static constexpr std::size_t ReadBufferSize = 65536;
+static constexpr int MaxEventsPerPoll = 64;
+// bound the work done for one readable socket per poll so that a chatty client
+// cannot starve the others sharing the loop
+static constexpr int MaxReadsPerEvent = 16;
+
+namespace EasyIpc {
+
+class Connection {
+   public:
+    Connection(int fd, int epoll_fd) : fd(fd), epoll_fd(epoll_fd) {}
+    ~Connection();
+
+    // Write one frame without blocking. Whatever the socket does not accept right
+    // now is buffered and flushed by the event loop. Takes ownership of fds.
+    // Callable from any thread.
+    bool Send(MessageHeader header, const std::string& body, std::vector<int> fds = {});
+
+    // Flush buffered output, called by the event loop on EPOLLOUT.
+    bool Flush();
+
+    const int fd;
+    const int epoll_fd;
+
+    // read state, only touched by the loop thread
+    char header_buf[sizeof(MessageHeader)];
+    std::size_t header_filled = 0;
+    bool reading_body = false;
+    Message incoming;
+    std::uint32_t incoming_flags = 0;
+    std::uint32_t incoming_fd_count = 0;
+    std::size_t body_filled = 0;
+    // descriptors received ahead of the frames that claim them
+    std::vector<int> received_fds;
+
+    // guards everything below
+    std::mutex mutex;
+    bool closed = false;
+    // set by the loop thread on handshake; the loop consumes client_to_server,
+    // senders produce server_to_client under the mutex
+    std::shared_ptr<SharedMemoryChannel> shared_memory;
+    // an ordered message of this connection is queued or running, the ones behind
+    // it wait here with their priority class
+    bool busy = false;
+    std::deque<std::pair<Message, std::size_t>> pending;
+
+   private:
+    void WatchWritable(bool enable);
+
+    std::string out_buf_;
+    std::size_t out_offset_ = 0;
+    // descriptors to pass with the byte at the given offset of out_buf_
+    std::deque<std::pair<std::size_t, std::vector<int>>> out_fds_;
+    bool watch_writable_ = false;
+};
+
+static void CloseFds(std::vector<int>& fds) {
+    for (int fd : fds) ::close(fd);
+    fds.clear();
+}
+
+Connection::~Connection() {
+    for (auto& item : out_fds_) CloseFds(item.second);
+}
+
+void Connection::WatchWritable(bool enable) {
+    if (watch_writable_ == enable)
+        return;
+
+    epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = enable ? (EPOLLIN | EPOLLOUT) : EPOLLIN;
+    ev.data.fd = fd;
+    ::epoll_ctl(epoll_fd, EPOLL_CTL_MOD, fd, &ev);
+    watch_writable_ = enable;
+}
+
+bool Connection::Send(MessageHeader header, const std::string& body, std::vector<int> fds) {
+    std::lock_guard<std::mutex> guard(mutex);
+    if (closed) {
+        CloseFds(fds);
+        return false;
+    }
+
+    const char* body_data = body.data();
+    std::size_t body_size = body.size();
+
+    SharedMemoryDoorbell doorbell;
+    if (shared_memory && body_size >= SharedMemoryThreshold &&
+        shared_memory->server_to_client().Write(body_data, body_size, doorbell)) {
+        header.flags |= FlagSharedMemory;
+        body_data = reinterpret_cast<const char*>(&doorbell);
+        body_size = sizeof(doorbell);
+    }
+    header.body_size = body_size;
+    header.fd_count = fds.size();
+
+    std::size_t total = sizeof(MessageHeader) + body_size;
+    std::size_t sent = 0;
+
+    // Nothing queued ahead of us: try to hand header and body to the kernel directly
+    // so that the common case does not copy the body into the output buffer.
+    if (out_buf_.size() == out_offset_) {
+        iovec iov[2];
+        iov[0].iov_base = &header;
+        iov[0].iov_len = sizeof(MessageHeader);
+        iov[1].iov_base = const_cast<char*>(body_data);
+        iov[1].iov_len = body_size;
+
+        while (true) {
+            ssize_t written = SendWithFds(fd, iov, body_size == 0 ? 1 : 2, fds, MSG_DONTWAIT);
+            if (written >= 0) {
+                sent = written;
+                break;
+            }
+            if (errno == EINTR)
+                continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+                break;
+            // the loop will notice the broken socket and close it
+            CloseFds(fds);
+            return false;
+        }
+
+        if (sent > 0) {
+            // the kernel holds its own references now
+            CloseFds(fds);
+        }
+
+        if (sent == total)
+            return true;
+
+        out_buf_.clear();
+        out_offset_ = 0;
+    }
+
+    if (!fds.empty()) {
+        out_fds_.emplace_back(out_buf_.size(), std::move(fds));
+    }
+
+    const char* header_bytes = reinterpret_cast<const char*>(&header);
+    if (sent < sizeof(MessageHeader)) {
+        out_buf_.append(header_bytes + sent, sizeof(MessageHeader) - sent);
+        out_buf_.append(body_data, body_size);
+    } else {
+        std::size_t body_sent = sent - sizeof(MessageHeader);
+        out_buf_.append(body_data + body_sent, body_size - body_sent);
+    }
+
+    WatchWritable(true);
+    return true;
+}
+
+bool Connection::Flush() {
+    std::lock_guard<std::mutex> guard(mutex);
+    if (closed)
+        return false;
+
+    while (out_offset_ < out_buf_.size()) {
+        // send up to the next byte that carries descriptors, or with them if we are there
+        std::size_t end = out_buf_.size();
+        std::vector<int> no_fds;
+        std::vector<int>* fds = &no_fds;
+        if (!out_fds_.empty()) {
+            if (out_fds_.front().first == out_offset_) {
+                fds = &out_fds_.front().second;
+                if (out_fds_.size() > 1)
+                    end = out_fds_[1].first;
+            } else {
+                end = out_fds_.front().first;
+            }
+        }
+
+        iovec iov;
+        iov.iov_base = &out_buf_[out_offset_];
+        iov.iov_len = end - out_offset_;
+        ssize_t written = SendWithFds(fd, &iov, 1, *fds, MSG_DONTWAIT);
+        if (written < 0) {
+            if (errno == EINTR)
+                continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+                return true;
+            return false;
+        }
+        if (written > 0 && fds != &no_fds) {
+            CloseFds(*fds);
+            out_fds_.pop_front();
+        }
+        out_offset_ += written;
+    }
+
+    out_buf_.clear();
+    out_offset_ = 0;
+    WatchWritable(false);
+    return true;
+}
+
+// Run the handler for req, send its response and call then(). With an async message
+// handler the response, and then(), may come after this returned, from another
+// thread.
+template <class Then>
+static void Respond(const std::weak_ptr<IpcServer>& weak_server,
+                    const std::shared_ptr<Connection>& conn, Message&& req, std::uint32_t flags,
+                    Then&& then) {
+    MessageHeader resp_header;
+    resp_header.request_id = req.request_id;
+    resp_header.message_type = req.message_type;
+
+    Context::FrameWriter frame_writer;
+    if (flags & FlagStreaming) {
+        frame_writer = [conn, resp_header, flags](bool progress, const std::string& body) {
+            MessageHeader partial_header = resp_header;
+            partial_header.flags = PartialFrameFlags(flags, progress);
+            return conn->Send(partial_header, body);
+        };
+    }
+
+    resp_header.flags = flags & FlagPipelined;
+    auto server = weak_server.lock();
+    if (server && server->async_message_handler) {
+        InvokeAsyncMessageHandler(
+            server, std::move(req), std::move(frame_writer),
+            [conn, resp_header, then = std::forward<Then>(then)](
+                std::string& response_content, std::vector<int>& response_fds) mutable {
+                resp_header.body_size = response_content.size();
+                conn->Send(resp_header, response_content, std::move(response_fds));
+                then();
+            });
+        return;
+    }
+
+    std::string response_content;
+    std::vector<int> response_fds;
+    if (server) {
+        response_content = InvokeMessageHandler(server, req, response_fds, frame_writer);
+    }
+    CloseFds(req.fds);
+
+    resp_header.body_size = response_content.size();
+    conn->Send(resp_header, response_content, std::move(response_fds));
+    RecycleResponseBuffer(std::move(response_content));
+    then();
+}
+
+// Answer a request the scheduler did not admit.
+static void RejectBusy(const std::weak_ptr<IpcServer>& weak_server, Connection& conn,
+                       Message& req, std::uint32_t flags) {
+    CloseFds(req.fds);
+    if (auto server = weak_server.lock()) {
+        auto& rejected = server->metrics().ForType(req.message_type).rejected;
+        rejected.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    MessageHeader resp_header;
+    resp_header.request_id = req.request_id;
+    resp_header.message_type = req.message_type;
+    resp_header.flags = (flags & FlagPipelined) | FlagBusy;
+    conn.Send(resp_header, "");
+}
+
+// Ordered messages of one connection are submitted one at a time, the next one only
+// once the previous has been answered, so responses go out in the order requests
+// arrived. Called with conn->busy set.
+static void SubmitOrdered(std::weak_ptr<IpcServer> weak_server,
+                          std::shared_ptr<Scheduler> scheduler, std::shared_ptr<Connection> conn,
+                          Message req, std::size_t cls) {
+    while (true) {
+        if (scheduler->Reserve(cls)) {
+            scheduler->Submit(cls, [weak_server, scheduler, conn, req = std::move(req)]() mutable {
+                Respond(weak_server, conn, std::move(req), 0, [weak_server, scheduler, conn] {
+                    std::unique_lock<std::mutex> lk(conn->mutex);
+                    if (conn->closed || conn->pending.empty()) {
+                        conn->busy = false;
+                        return;
+                    }
+                    auto next = std::move(conn->pending.front());
+                    conn->pending.pop_front();
+                    lk.unlock();
+                    SubmitOrdered(weak_server, scheduler, conn, std::move(next.first),
+                                  next.second);
+                });
+            });
+            return;
+        }
+
+        RejectBusy(weak_server, *conn, req, 0);
+
+        std::lock_guard<std::mutex> guard(conn->mutex);
+        if (conn->closed || conn->pending.empty()) {
+            conn->busy = false;
+            return;
+        }
+        req = std::move(conn->pending.front().first);
+        cls = conn->pending.front().second;
+        conn->pending.pop_front();
+    }
+}
+
+EventLoop::EventLoop(std::weak_ptr<IpcServer> server, std::shared_ptr<Scheduler> scheduler)
+    : server_(server), scheduler_(std::move(scheduler)) {}
+
+EventLoop::~EventLoop() {
+    if (wakeup_fd_ >= 0)
+        ::close(wakeup_fd_);
+    if (epoll_fd_ >= 0)
+        ::close(epoll_fd_);
+}
+
+bool EventLoop::Init() {
+    epoll_fd_ = ::epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd_ < 0)
+        return false;
+
+    wakeup_fd_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wakeup_fd_ < 0)
+        return false;
+
+    epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.fd = wakeup_fd_;
+    return ::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, wakeup_fd_, &ev) == 0;
+}
+
+void EventLoop::Wakeup() {
+    std::uint64_t one = 1;
+    ssize_t ignored = ::write(wakeup_fd_, &one, sizeof(one));
+    (void)ignored;
+}
+
+void EventLoop::Stop() {
+    stop_ = true;
+    Wakeup();
+}
+
+void EventLoop::Adopt(int socket) {
+    {
+        std::lock_guard<std::mutex> guard(incoming_mutex_);
+        incoming_.push_back(socket);
+    }
+    Wakeup();
+}
+
+void EventLoop::AddConnection(int socket) {
+    int flags = ::fcntl(socket, F_GETFL, 0);
+    ::fcntl(socket, F_SETFL, flags | O_NONBLOCK);
+
+    epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.fd = socket;
+    if (::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, socket, &ev) != 0) {
+        ::close(socket);
+        return;
+    }
+
+    connections_[socket] = std::make_shared<Connection>(socket, epoll_fd_);
+}
+
+void EventLoop::AcceptConnections(int listen_fd, const std::vector<EventLoop*>& loops) {
+    while (true) {
+        int socket = ::accept4(listen_fd, nullptr, nullptr, SOCK_CLOEXEC);
+        if (socket < 0) {
+            if (errno == EINTR)
+                continue;
+            return;
+        }
+
+        EventLoop* target = loops[next_loop_++ % loops.size()];
+        if (target == this) {
+            AddConnection(socket);
+        } else {
+            target->Adopt(socket);
+        }
+    }
+}
+
+bool EventLoop::ConsumeBytes(const std::shared_ptr<Connection>& conn, const char* data,
+                             std::size_t size) {
+    std::size_t offset = 0;
+    while (offset < size) {
+        std::size_t available = size - offset;
+        if (!conn->reading_body) {
+            std::size_t n = std::min(available, sizeof(MessageHeader) - conn->header_filled);
+            memcpy(conn->header_buf + conn->header_filled, data + offset, n);
+            conn->header_filled += n;
+            offset += n;
+            if (conn->header_filled < sizeof(MessageHeader))
+                return true;
+
+            MessageHeader header;
+            memcpy(&header, conn->header_buf, sizeof(MessageHeader));
+            conn->header_filled = 0;
+            conn->incoming = Message();
+            conn->incoming.request_id = header.request_id;
+            conn->incoming.message_type = header.message_type;
+            conn->incoming_flags = header.flags;
+            conn->incoming_fd_count = header.fd_count;
+            conn->incoming.content.resize(header.body_size);
+            conn->body_filled = 0;
+            conn->reading_body = true;
+        } else {
+            std::size_t n = std::min(available, conn->incoming.content.size() - conn->body_filled);
+            memcpy(&conn->incoming.content[conn->body_filled], data + offset, n);
+            conn->body_filled += n;
+            offset += n;
+        }
+
+        if (conn->body_filled == conn->incoming.content.size() && !CompleteFrame(conn)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool EventLoop::CompleteFrame(const std::shared_ptr<Connection>& conn) {
+    conn->reading_body = false;
+    Message req = std::move(conn->incoming);
+    std::uint32_t flags = conn->incoming_flags;
+
+    // descriptors arrive with (or ahead of) the header of the frame that claims them
+    std::uint32_t fd_count = conn->incoming_fd_count;
+    if (conn->received_fds.size() < fd_count) {
+        CloseConnection(conn);
+        return false;
+    }
+    std::vector<int>& fds = req.fds;
+    fds.assign(conn->received_fds.begin(), conn->received_fds.begin() + fd_count);
+    conn->received_fds.erase(conn->received_fds.begin(), conn->received_fds.begin() + fd_count);
+
+    if (flags & FlagSharedMemoryHandshake) {
+        std::shared_ptr<SharedMemoryChannel> channel;
+        if (fds.size() == 1 && !conn->shared_memory) {
+            channel = SharedMemoryChannel::Attach(fds[0]);
+            fds.clear();
+        }
+        CloseFds(fds);
+
+        MessageHeader resp_header;
+        resp_header.request_id = req.request_id;
+        resp_header.message_type = req.message_type;
+        resp_header.flags = FlagSharedMemoryHandshake;
+        // the answer itself must still go through the socket
+        conn->Send(resp_header, channel ? "ok" : "");
+        if (channel) {
+            std::lock_guard<std::mutex> guard(conn->mutex);
+            conn->shared_memory = channel;
+        }
+        return true;
+    }
+
+    if (flags & FlagSharedMemory) {
+        SharedMemoryDoorbell doorbell;
+        bool ok = conn->shared_memory && req.content.size() == sizeof(doorbell);
+        if (ok) {
+            memcpy(&doorbell, req.content.data(), sizeof(doorbell));
+            ok = conn->shared_memory->client_to_server().Read(doorbell, req.content);
+        }
+        if (!ok) {
+            CloseFds(fds);
+            CloseConnection(conn);
+            return false;
+        }
+    }
+
+    req.received_at = std::chrono::steady_clock::now();
+    Dispatch(conn, std::move(req), flags);
+    return true;
+}
+
+void EventLoop::HandleReadable(const std::shared_ptr<Connection>& conn) {
+    static thread_local std::vector<char> read_buf(ReadBufferSize);
+
+    for (int i = 0; i < MaxReadsPerEvent; i++) {
+        ssize_t read_bytes;
+
+        if (conn->reading_body &&
+            conn->incoming.content.size() - conn->body_filled >= ReadBufferSize) {
+            // large body: receive straight into the message instead of bouncing
+            // through the read buffer
+            read_bytes = ReceiveWithFds(conn->fd, &conn->incoming.content[conn->body_filled],
+                                        conn->incoming.content.size() - conn->body_filled, 0,
+                                        conn->received_fds);
+            if (read_bytes > 0) {
+                conn->body_filled += read_bytes;
+                if (conn->body_filled == conn->incoming.content.size() && !CompleteFrame(conn)) {
+                    return;
+                }
+            }
+        } else {
+            read_bytes = ReceiveWithFds(conn->fd, read_buf.data(), read_buf.size(), 0,
+                                        conn->received_fds);
+            if (read_bytes > 0 && !ConsumeBytes(conn, read_buf.data(), read_bytes)) {
+                return;
+            }
+        }
+
+        if (read_bytes == 0) {
+            CloseConnection(conn);
+            return;
+        }
+
+        if (read_bytes < 0) {
+            if (errno == EINTR)
+                continue;
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+                CloseConnection(conn);
+            return;
+        }
+    }
+}
+
+void EventLoop::Dispatch(const std::shared_ptr<Connection>& conn, Message&& req,
+                         std::uint32_t flags) {
+    std::size_t cls = scheduler_->Classify(req, flags);
+
+    if (flags & FlagPipelined) {
+        // the client matches responses by request id, run it concurrently with
+        // everything else in flight on this connection
+        if (!scheduler_->Reserve(cls)) {
+            RejectBusy(server_, *conn, req, flags);
+            return;
+        }
+        scheduler_->Submit(cls, [server = server_, conn, req = std::move(req), flags]() mutable {
+            Respond(server, conn, std::move(req), flags, [] {});
+        });
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(conn->mutex);
+        if (conn->closed) {
+            CloseFds(req.fds);
+            return;
+        }
+        if (conn->busy) {
+            conn->pending.emplace_back(std::move(req), cls);
+            return;
+        }
+        conn->busy = true;
+    }
+
+    SubmitOrdered(server_, scheduler_, conn, std::move(req), cls);
+}
+
+void EventLoop::HandleWritable(const std::shared_ptr<Connection>& conn) {
+    if (!conn->Flush()) {
+        CloseConnection(conn);
+    }
+}
+
+void EventLoop::CloseConnection(const std::shared_ptr<Connection>& conn) {
+    {
+        std::lock_guard<std::mutex> guard(conn->mutex);
+        if (conn->closed)
+            return;
+        conn->closed = true;
+        for (auto& item : conn->pending) CloseFds(item.first.fds);
+        conn->pending.clear();
+        conn->shared_memory.reset();
+        ::epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, conn->fd, nullptr);
+        ::close(conn->fd);
+    }
+    for (int fd : conn->received_fds) ::close(fd);
+    conn->received_fds.clear();
+    connections_.erase(conn->fd);
+
+    auto server = server_.lock();
+    if (server && server->client_disconnect_handler) {
+        Context ctx(server);
+        Session session(server, conn->fd);
+        server->client_disconnect_handler(ctx, session);
+    }
+}
+
+void EventLoop::Run(int listen_fd, const std::vector<EventLoop*>& loops) {
+    if (listen_fd >= 0) {
+        int flags = ::fcntl(listen_fd, F_GETFL, 0);
+        ::fcntl(listen_fd, F_SETFL, flags | O_NONBLOCK);
+
+        epoll_event ev;
+        memset(&ev, 0, sizeof(ev));
+        ev.events = EPOLLIN;
+        ev.data.fd = listen_fd;
+        ::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, listen_fd, &ev);
+    }
+
+    epoll_event events[MaxEventsPerPoll];
+    while (!stop_) {
+        int count = ::epoll_wait(epoll_fd_, events, MaxEventsPerPoll, -1);
+        if (count < 0) {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+
+        for (int i = 0; i < count; i++) {
+            int fd = events[i].data.fd;
+            std::uint32_t flags = events[i].events;
+
+            if (fd == wakeup_fd_) {
+                std::uint64_t value;
+                ssize_t ignored = ::read(wakeup_fd_, &value, sizeof(value));
+                (void)ignored;
+
+                std::vector<int> sockets;
+                {
+                    std::lock_guard<std::mutex> guard(incoming_mutex_);
+                    sockets.swap(incoming_);
+                }
+                for (int socket : sockets) AddConnection(socket);
+                continue;
+            }
+
+            if (fd == listen_fd) {
+                AcceptConnections(listen_fd, loops);
+                continue;
+            }
+
+            auto it = connections_.find(fd);
+            if (it == connections_.end())
+                continue;
+            std::shared_ptr<Connection> conn = it->second;
+
+            if (flags & EPOLLERR) {
+                CloseConnection(conn);
+                continue;
+            }
+            if (flags & (EPOLLIN | EPOLLHUP)) {
+                // a hang up is reported by recv() returning 0
+                HandleReadable(conn);
+            }
+            if ((flags & EPOLLOUT) && !conn->closed) {
+                HandleWritable(conn);
+            }
+        }
+    }
+
+    if (listen_fd >= 0) {
+        ::epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, listen_fd, nullptr);
+    }
+
+    // Workers may still hold connections; mark them closed so that late responses
+    // are dropped instead of being written to a recycled descriptor.
+    for (auto& item : connections_) {
+        std::lock_guard<std::mutex> guard(item.second->mutex);
+        item.second->closed = true;
+        for (auto& pending : item.second->pending) CloseFds(pending.first.fds);
+        item.second->pending.clear();
+        item.second->shared_memory.reset();
+        ::close(item.second->fd);
+        for (int fd : item.second->received_fds) ::close(fd);
+    }
+    connections_.clear();
+
+    std::lock_guard<std::mutex> guard(incoming_mutex_);
+    for (int socket : incoming_) ::close(socket);
+    incoming_.clear();
+}
+
+Reactor::Reactor(std::weak_ptr<IpcServer> server, std::shared_ptr<Scheduler> scheduler,
+                 std::size_t io_thread_count) {
+    io_thread_count = std::max<std::size_t>(io_thread_count, 1);
+    for (std::size_t i = 0; i < io_thread_count; i++) {
+        loops_.push_back(std::make_unique<EventLoop>(server, scheduler));
+    }
+}
+
+Reactor::~Reactor() {
+    Stop();
+    for (auto& thread : threads_) {
+        if (thread.joinable())
+            thread.join();
+    }
+}
+
+bool Reactor::Serve(int listen_fd) {
+    std::vector<EventLoop*> loops;
+    for (auto& loop : loops_) {
+        if (!loop->Init())
+            return false;
+        loops.push_back(loop.get());
+    }
+
+    for (std::size_t i = 1; i < loops.size(); i++) {
+        threads_.emplace_back([loop = loops[i], &loops] { loop->Run(-1, loops); });
+    }
+
+    if (!stopped_) {
+        loops[0]->Run(listen_fd, loops);
+    }
+
+    Stop();
+    for (auto& thread : threads_) thread.join();
+    threads_.clear();
+    return true;
+}
+
+void Reactor::Stop() {
+    stopped_ = true;
+    for (auto& loop : loops_) loop->Stop();
+}
+
+}  // namespace EasyIpc
+
+#endif  // __linux__
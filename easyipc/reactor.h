@@ -0,0 +1,87 @@
+//
+// Event-driven server core: sockets are owned by a few epoll threads which parse
+// frames without blocking and only hand complete messages to the thread pool.
+//
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace EasyIpc {
+
+class IpcServer;
+class Message;
+class Connection;
+class Scheduler;
+
+class EventLoop {
+   public:
+    EventLoop(std::weak_ptr<IpcServer> server, std::shared_ptr<Scheduler> scheduler);
+    EventLoop(const EventLoop&) = delete;
+    EventLoop& operator=(const EventLoop&) = delete;
+    ~EventLoop();
+
+    bool Init();
+
+    // Poll until Stop() is called. If listen_fd >= 0 this loop also accepts new
+    // connections and distributes them over `loops` round-robin.
+    void Run(int listen_fd, const std::vector<EventLoop*>& loops);
+
+    // thread-safe
+    void Stop();
+    void Adopt(int socket);
+
+   private:
+    void Wakeup();
+    void AddConnection(int socket);
+    void AcceptConnections(int listen_fd, const std::vector<EventLoop*>& loops);
+    void HandleReadable(const std::shared_ptr<Connection>& conn);
+    // return false once the connection has been closed
+    bool ConsumeBytes(const std::shared_ptr<Connection>& conn, const char* data, std::size_t size);
+    bool CompleteFrame(const std::shared_ptr<Connection>& conn);
+    void Dispatch(const std::shared_ptr<Connection>& conn, Message&& req, std::uint32_t flags);
+    void HandleWritable(const std::shared_ptr<Connection>& conn);
+    void CloseConnection(const std::shared_ptr<Connection>& conn);
+
+    std::weak_ptr<IpcServer> server_;
+    std::shared_ptr<Scheduler> scheduler_;
+
+    int epoll_fd_ = -1;
+    int wakeup_fd_ = -1;
+    std::atomic<bool> stop_{false};
+
+    // only touched by the loop thread
+    std::unordered_map<int, std::shared_ptr<Connection>> connections_;
+    std::size_t next_loop_ = 0;
+
+    std::mutex incoming_mutex_;
+    std::vector<int> incoming_;
+};
+
+class Reactor {
+   public:
+    Reactor(std::weak_ptr<IpcServer> server, std::shared_ptr<Scheduler> scheduler,
+            std::size_t io_thread_count);
+    Reactor(const Reactor&) = delete;
+    Reactor& operator=(const Reactor&) = delete;
+    ~Reactor();
+
+    // Blocks the calling thread (which runs the first event loop) until Stop().
+    bool Serve(int listen_fd);
+
+    // thread-safe, may be called from inside a handler
+    void Stop();
+
+   private:
+    std::vector<std::unique_ptr<EventLoop>> loops_;
+    std::vector<std::thread> threads_;
+    std::atomic<bool> stopped_{false};
+};
+
+}  // namespace EasyIpc
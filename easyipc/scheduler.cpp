@@ -0,0 +1,114 @@
+#include "scheduler.h"
+
+#include <algorithm>
+
+#include "protocol.h"
+
+namespace EasyIpc {
+
+Scheduler::Scheduler(ThreadPool* pool, std::vector<PriorityClass> classes,
+                     std::unordered_map<std::int32_t, std::size_t> message_type_priority,
+                     std::size_t default_priority)
+    : classes_(classes.empty() ? std::vector<PriorityClass>(1) : std::move(classes)),
+      message_type_priority_(std::move(message_type_priority)),
+      default_priority_(std::min(default_priority, classes_.size() - 1)),
+      queues_(classes_.size()),
+      reserved_(classes_.size(), 0),
+      running_(classes_.size(), 0) {
+    for (const PriorityClass& cls : classes_) {
+        ThreadPool* class_pool = cls.pool ? cls.pool : pool;
+        auto it = std::find_if(pools_.begin(), pools_.end(),
+                               [class_pool](const Pool& p) { return p.pool == class_pool; });
+        if (it == pools_.end()) {
+            pools_.push_back(Pool{class_pool, std::max<std::size_t>(class_pool->size(), 1), 0});
+            it = pools_.end() - 1;
+        }
+        class_pool_.push_back(it - pools_.begin());
+    }
+}
+
+std::size_t Scheduler::Classify(const Message& req, std::uint32_t flags) const {
+    std::uint32_t requested = (flags & PriorityMask) >> PriorityShift;
+    if (requested > 0) {
+        return std::min<std::size_t>(requested - 1, classes_.size() - 1);
+    }
+
+    auto it = message_type_priority_.find(req.message_type);
+    if (it != message_type_priority_.end()) {
+        return std::min(it->second, classes_.size() - 1);
+    }
+    return default_priority_;
+}
+
+bool Scheduler::Reserve(std::size_t cls) {
+    cls = std::min(cls, classes_.size() - 1);
+    std::lock_guard<std::mutex> guard(mutex_);
+    std::size_t limit = classes_[cls].max_queued;
+    if (limit > 0 && queues_[cls].size() + reserved_[cls] >= limit) {
+        return false;
+    }
+    reserved_[cls]++;
+    return true;
+}
+
+void Scheduler::Submit(std::size_t cls, std::function<void()> task) {
+    cls = std::min(cls, classes_.size() - 1);
+    Pool& pool = pools_[class_pool_[cls]];
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        reserved_[cls]--;
+        queues_[cls].push_back(std::move(task));
+
+        // A class at its limit is resumed by its own finishing runner.
+        std::size_t limit = classes_[cls].max_concurrency;
+        if (pool.runners >= pool.max_runners || (limit > 0 && running_[cls] >= limit)) {
+            return;
+        }
+        pool.runners++;
+    }
+
+    try {
+        pool.pool->post([self = shared_from_this(), p = class_pool_[cls]] { self->RunQueued(p); });
+    } catch (...) {
+        // the pool is shutting down, the task stays queued and is dropped with us
+        std::lock_guard<std::mutex> guard(mutex_);
+        pool.runners--;
+    }
+}
+
+bool Scheduler::PopRunnable(std::size_t pool, std::size_t& cls, std::function<void()>& task) {
+    for (std::size_t i = 0; i < queues_.size(); i++) {
+        std::size_t limit = classes_[i].max_concurrency;
+        if (class_pool_[i] != pool || queues_[i].empty() || (limit > 0 && running_[i] >= limit))
+            continue;
+
+        cls = i;
+        task = std::move(queues_[i].front());
+        queues_[i].pop_front();
+        return true;
+    }
+    return false;
+}
+
+void Scheduler::RunQueued(std::size_t pool) {
+    std::size_t cls;
+    std::function<void()> task;
+
+    std::unique_lock<std::mutex> lk(mutex_);
+    while (PopRunnable(pool, cls, task)) {
+        running_[cls]++;
+        lk.unlock();
+
+        try {
+            task();
+        } catch (...) {
+        }
+        task = nullptr;
+
+        lk.lock();
+        running_[cls]--;
+    }
+    pools_[pool].runners--;
+}
+
+}  // namespace EasyIpc
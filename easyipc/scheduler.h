@@ -0,0 +1,71 @@
+//
+// Admission control between the reactor and the thread pool. Requests wait in one
+// queue per priority class and are handed to workers most urgent class first,
+// within the per-class concurrency limits.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "ThreadPool/ThreadPool.h"
+#include "easyipc.h"
+
+namespace EasyIpc {
+
+class Scheduler : public std::enable_shared_from_this<Scheduler> {
+   public:
+    // pool runs the classes that do not name their own
+    Scheduler(ThreadPool* pool, std::vector<PriorityClass> classes,
+              std::unordered_map<std::int32_t, std::size_t> message_type_priority,
+              std::size_t default_priority);
+    Scheduler(const Scheduler&) = delete;
+    Scheduler& operator=(const Scheduler&) = delete;
+
+    // Class of a request: the one the client asked for in the header flags, else the
+    // one configured for its message type, else the default.
+    std::size_t Classify(const Message& req, std::uint32_t flags) const;
+
+    // Reserve a place in the queue of class cls, false if max_queued requests are
+    // already waiting there. Every successful call must be followed by one Submit()
+    // of the same class. Thread-safe.
+    bool Reserve(std::size_t cls);
+
+    // Queue task in a place reserved before. Thread-safe.
+    void Submit(std::size_t cls, std::function<void()> task);
+
+   private:
+    struct Pool {
+        ThreadPool* pool;
+        // never occupy more workers than the pool has, so that the queues rather than
+        // the pool's FIFO decide what runs next
+        std::size_t max_runners;
+        std::size_t runners;
+    };
+
+    // Body of a pool task: keeps running queued tasks of the classes on pools_[pool]
+    // until none may start.
+    void RunQueued(std::size_t pool);
+    // requires mutex_
+    bool PopRunnable(std::size_t pool, std::size_t& cls, std::function<void()>& task);
+
+    const std::vector<PriorityClass> classes_;
+    const std::unordered_map<std::int32_t, std::size_t> message_type_priority_;
+    const std::size_t default_priority_;
+    std::vector<Pool> pools_;
+    // index into pools_ of each class
+    std::vector<std::size_t> class_pool_;
+
+    std::mutex mutex_;
+    std::vector<std::deque<std::function<void()>>> queues_;
+    std::vector<std::size_t> reserved_;
+    std::vector<std::size_t> running_;
+};
+
+}  // namespace EasyIpc
@@ -0,0 +1,165 @@
+#include "shm.h"
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cstring>
+#include <new>
+
+static constexpr std::uint64_t ChannelMagic = 0x616e692d73686d31;  // "ani-shm1"
+static constexpr std::size_t ControlAreaSize = 4096;
+
+namespace EasyIpc {
+
+// head is only written by the producer, tail only by the consumer; keep them on
+// separate cache lines
+struct RingControl {
+    alignas(64) std::atomic<std::uint64_t> head;
+    alignas(64) std::atomic<std::uint64_t> tail;
+};
+
+struct ChannelControl {
+    std::uint64_t magic;
+    std::uint64_t ring_capacity;
+    RingControl rings[2];
+};
+
+static_assert(sizeof(ChannelControl) <= ControlAreaSize, "control area too small");
+
+bool SharedMemoryRing::Write(const char* data, std::size_t size, SharedMemoryDoorbell& doorbell) {
+    if (size == 0 || size > capacity_)
+        return false;
+
+    std::uint64_t head = control_->head.load(std::memory_order_relaxed);
+    std::uint64_t tail = control_->tail.load(std::memory_order_acquire);
+
+    // payloads are stored contiguously, skip the rest of the ring if it does not fit
+    std::uint64_t start = head;
+    std::uint64_t offset = head % capacity_;
+    if (offset + size > capacity_) {
+        start += capacity_ - offset;
+        offset = 0;
+    }
+
+    std::uint64_t end = start + size;
+    if (end - tail > capacity_)
+        return false;
+
+    memcpy(data_ + offset, data, size);
+    control_->head.store(end, std::memory_order_release);
+
+    doorbell.offset = offset;
+    doorbell.size = size;
+    doorbell.end = end;
+    return true;
+}
+
+bool SharedMemoryRing::Read(const SharedMemoryDoorbell& doorbell, std::string& out) {
+    std::uint64_t head = control_->head.load(std::memory_order_acquire);
+    std::uint64_t tail = control_->tail.load(std::memory_order_relaxed);
+
+    if (doorbell.size > capacity_ || doorbell.offset > capacity_ - doorbell.size ||
+        doorbell.end > head || doorbell.end <= tail) {
+        return false;
+    }
+
+    out.assign(data_ + doorbell.offset, doorbell.size);
+    control_->tail.store(doorbell.end, std::memory_order_release);
+    return true;
+}
+
+SharedMemoryChannel::SharedMemoryChannel(int fd, char* base, std::size_t mapped_size,
+                                         std::size_t ring_capacity)
+    : fd_(fd),
+      base_(base),
+      mapped_size_(mapped_size),
+      client_to_server_(&reinterpret_cast<ChannelControl*>(base)->rings[0],
+                        base + ControlAreaSize, ring_capacity),
+      server_to_client_(&reinterpret_cast<ChannelControl*>(base)->rings[1],
+                        base + ControlAreaSize + ring_capacity, ring_capacity) {}
+
+#ifdef __linux__
+
+std::unique_ptr<SharedMemoryChannel> SharedMemoryChannel::Create(std::size_t ring_capacity) {
+    int fd = ::memfd_create("easyipc-shm", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (fd < 0)
+        return nullptr;
+
+    std::size_t mapped_size = ControlAreaSize + 2 * ring_capacity;
+    if (::ftruncate(fd, mapped_size) != 0) {
+        ::close(fd);
+        return nullptr;
+    }
+    // the peer may rely on the size never changing under its mapping
+    ::fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL);
+
+    void* base = ::mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) {
+        ::close(fd);
+        return nullptr;
+    }
+
+    auto control = new (base) ChannelControl;
+    control->magic = ChannelMagic;
+    control->ring_capacity = ring_capacity;
+    for (auto& ring : control->rings) {
+        ring.head = 0;
+        ring.tail = 0;
+    }
+
+    return std::unique_ptr<SharedMemoryChannel>(
+        new SharedMemoryChannel(fd, static_cast<char*>(base), mapped_size, ring_capacity));
+}
+
+std::unique_ptr<SharedMemoryChannel> SharedMemoryChannel::Attach(int fd) {
+    // without the seal the peer could truncate the file and fault us with SIGBUS
+    int seals = ::fcntl(fd, F_GET_SEALS);
+    struct stat st;
+    if (seals < 0 || !(seals & F_SEAL_SHRINK) || ::fstat(fd, &st) != 0 ||
+        static_cast<std::size_t>(st.st_size) < ControlAreaSize) {
+        ::close(fd);
+        return nullptr;
+    }
+
+    std::size_t mapped_size = st.st_size;
+    void* base = ::mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) {
+        ::close(fd);
+        return nullptr;
+    }
+
+    auto control = static_cast<ChannelControl*>(base);
+    std::uint64_t ring_capacity = control->ring_capacity;
+    if (control->magic != ChannelMagic || ring_capacity == 0 ||
+        ring_capacity > (mapped_size - ControlAreaSize) / 2) {
+        ::munmap(base, mapped_size);
+        ::close(fd);
+        return nullptr;
+    }
+
+    return std::unique_ptr<SharedMemoryChannel>(
+        new SharedMemoryChannel(fd, static_cast<char*>(base), mapped_size, ring_capacity));
+}
+
+SharedMemoryChannel::~SharedMemoryChannel() {
+    ::munmap(base_, mapped_size_);
+    ::close(fd_);
+}
+
+#else
+
+std::unique_ptr<SharedMemoryChannel> SharedMemoryChannel::Create(std::size_t ring_capacity) {
+    return nullptr;
+}
+
+std::unique_ptr<SharedMemoryChannel> SharedMemoryChannel::Attach(int fd) { return nullptr; }
+
+SharedMemoryChannel::~SharedMemoryChannel() {}
+
+#endif  // __linux__
+
+}  // namespace EasyIpc
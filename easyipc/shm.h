@@ -0,0 +1,78 @@
+//
+// memfd-backed shared-memory rings used to move large payloads between the two
+// ends of a session. Only small doorbell frames travel over the socket.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace EasyIpc {
+
+// Payloads at least this large go through the ring once a channel is negotiated,
+// smaller ones are cheaper to send inline.
+static constexpr std::size_t SharedMemoryThreshold = 64 * 1024;
+static constexpr std::size_t DefaultRingCapacity = 16 * 1024 * 1024;
+
+// Sent on the socket instead of the payload. The payload is stored at
+// [offset, offset + size) of the ring data and occupies the ring up to position end.
+struct SharedMemoryDoorbell {
+    std::uint64_t offset = 0;
+    std::uint64_t size = 0;
+    std::uint64_t end = 0;
+};
+
+struct RingControl;
+
+// Single-producer single-consumer byte ring. The producer side must be serialized
+// with the socket writes so that doorbells arrive in the order payloads were placed.
+class SharedMemoryRing {
+   public:
+    SharedMemoryRing(RingControl* control, char* data, std::size_t capacity)
+        : control_(control), data_(data), capacity_(capacity) {}
+
+    // Returns false when the payload does not fit right now; the caller then falls
+    // back to sending it over the socket.
+    bool Write(const char* data, std::size_t size, SharedMemoryDoorbell& doorbell);
+
+    // Copy the payload out and release its space. Returns false if the doorbell
+    // does not describe a valid region.
+    bool Read(const SharedMemoryDoorbell& doorbell, std::string& out);
+
+   private:
+    RingControl* control_;
+    char* data_;
+    std::size_t capacity_;
+};
+
+class SharedMemoryChannel {
+   public:
+    // Create a new channel with two rings of ring_capacity bytes each.
+    static std::unique_ptr<SharedMemoryChannel> Create(std::size_t ring_capacity);
+
+    // Map a channel created by the peer. Takes ownership of fd.
+    static std::unique_ptr<SharedMemoryChannel> Attach(int fd);
+
+    SharedMemoryChannel(const SharedMemoryChannel&) = delete;
+    SharedMemoryChannel& operator=(const SharedMemoryChannel&) = delete;
+    ~SharedMemoryChannel();
+
+    int fd() const { return fd_; }
+
+    SharedMemoryRing& client_to_server() { return client_to_server_; }
+    SharedMemoryRing& server_to_client() { return server_to_client_; }
+
+   private:
+    SharedMemoryChannel(int fd, char* base, std::size_t mapped_size, std::size_t ring_capacity);
+
+    int fd_;
+    char* base_;
+    std::size_t mapped_size_;
+    SharedMemoryRing client_to_server_;
+    SharedMemoryRing server_to_client_;
+};
+
+}  // namespace EasyIpc
@@ -0,0 +1,93 @@
+//
+// Compares round trips over the plain socket path and over the shared-memory
+// ring for payloads from 1 KiB to 64 MiB. The server echoes the request, so every
+// round trip moves the payload in both directions.
+//
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "easyipc.h"
+
+using EasyIpc::IpcClient;
+using EasyIpc::IpcServer;
+
+static constexpr char BenchToken[] = "shm-bench";
+static constexpr std::size_t MaxPayloadSize = 64 * 1024 * 1024;
+// every round trip touches the payload twice, a ring must hold the largest one
+static constexpr std::size_t BenchRingCapacity = MaxPayloadSize + 1024 * 1024;
+static constexpr std::size_t BytesPerMeasurement = 512 * 1024 * 1024;
+
+static double measure(IpcClient& client, std::size_t size, int& iterations) {
+    std::string payload(size, 'x');
+    std::string resp;
+
+    iterations = std::max<std::size_t>(4, std::min<std::size_t>(2000, BytesPerMeasurement / size));
+
+    // warm up, the first round trip also faults in the ring pages
+    if (!client.Send(0, payload, resp) || resp.size() != size) {
+        return -1;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        resp.clear();
+        if (!client.Send(0, payload, resp) || resp.size() != size) {
+            return -1;
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::duration<double>>(end - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    auto server = std::make_shared<IpcServer>(BenchToken);
+    server->serve_mode = EasyIpc::ServeMode::Reactor;
+    server->message_handler = [](EasyIpc::Context& ctx, const EasyIpc::Message& msg) {
+        return msg.content;
+    };
+    std::thread server_thread([server] { server->Run(); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    IpcClient socket_client;
+    IpcClient shm_client;
+    if (!socket_client.Connect(BenchToken) || !shm_client.Connect(BenchToken)) {
+        std::cerr << "connect error" << std::endl;
+        return 1;
+    }
+    bool has_shm = shm_client.EnableSharedMemory(BenchRingCapacity);
+    if (!has_shm) {
+        std::cerr << "shared memory not available, both columns use the socket" << std::endl;
+    }
+
+    std::printf("%10s %8s %14s %14s %12s %12s\n", "size", "iters", "socket us/rt", "shm us/rt",
+                "socket MB/s", "shm MB/s");
+    for (std::size_t size = 1024; size <= MaxPayloadSize; size *= 4) {
+        int socket_iterations = 0;
+        int shm_iterations = 0;
+        double socket_secs = measure(socket_client, size, socket_iterations);
+        double shm_secs = measure(shm_client, size, shm_iterations);
+        if (socket_secs < 0 || shm_secs < 0) {
+            std::cerr << "send error at size " << size << std::endl;
+            return 1;
+        }
+
+        // payload crosses the boundary twice per round trip
+        double socket_mbps = 2.0 * size * socket_iterations / socket_secs / (1 << 20);
+        double shm_mbps = 2.0 * size * shm_iterations / shm_secs / (1 << 20);
+        std::printf("%10zu %8d %14.1f %14.1f %12.1f %12.1f\n", size, socket_iterations,
+                    socket_secs * 1e6 / socket_iterations, shm_secs * 1e6 / shm_iterations,
+                    socket_mbps, shm_mbps);
+    }
+
+    socket_client.Close();
+    shm_client.Close();
+    server->Shutdown();
+    server_thread.join();
+    return 0;
+}
@@ -1,3536 +0,0 @@
-// Generated by the protocol buffer compiler.  DO NOT EDIT!
-// source: ipc.proto
-
-#ifndef GOOGLE_PROTOBUF_INCLUDED_ipc_2eproto
-#define GOOGLE_PROTOBUF_INCLUDED_ipc_2eproto
-
-#include <limits>
-#include <string>
-
-#include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3011000
-#error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers. Please update
-#error your headers.
-#endif
-#if 3011002 < PROTOBUF_MIN_PROTOC_VERSION
-#error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers. Please
-#error regenerate this file with a newer version of protoc.
-#endif
-
-#include <google/protobuf/port_undef.inc>
-#include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/arena.h>
-#include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
-#include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
-#include <google/protobuf/metadata.h>
-#include <google/protobuf/generated_message_reflection.h>
-#include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
-#include <google/protobuf/extension_set.h>  // IWYU pragma: export
-#include <google/protobuf/generated_enum_reflection.h>
-#include <google/protobuf/unknown_field_set.h>
-// @@protoc_insertion_point(includes)
-#include <google/protobuf/port_def.inc>
-#define PROTOBUF_INTERNAL_EXPORT_ipc_2eproto
-PROTOBUF_NAMESPACE_OPEN
-namespace internal {
-class AnyMetadata;
-}  // namespace internal
-PROTOBUF_NAMESPACE_CLOSE
-
-// Internal implementation detail -- do not use these members.
-struct TableStruct_ipc_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[9]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
-};
-extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_ipc_2eproto;
-namespace proto {
-class ClassifyRequest;
-class ClassifyRequestDefaultTypeInternal;
-extern ClassifyRequestDefaultTypeInternal _ClassifyRequest_default_instance_;
-class ClassifyResponse;
-class ClassifyResponseDefaultTypeInternal;
-extern ClassifyResponseDefaultTypeInternal _ClassifyResponse_default_instance_;
-class ExifInfo;
-class ExifInfoDefaultTypeInternal;
-extern ExifInfoDefaultTypeInternal _ExifInfo_default_instance_;
-class GenerateThumbnailsRequest;
-class GenerateThumbnailsRequestDefaultTypeInternal;
-extern GenerateThumbnailsRequestDefaultTypeInternal _GenerateThumbnailsRequest_default_instance_;
-class GenerateThumbnailsResponse;
-class GenerateThumbnailsResponseDefaultTypeInternal;
-extern GenerateThumbnailsResponseDefaultTypeInternal _GenerateThumbnailsResponse_default_instance_;
-class ImageClass;
-class ImageClassDefaultTypeInternal;
-extern ImageClassDefaultTypeInternal _ImageClass_default_instance_;
-class ImageInfo;
-class ImageInfoDefaultTypeInternal;
-extern ImageInfoDefaultTypeInternal _ImageInfo_default_instance_;
-class ReadExifRequest;
-class ReadExifRequestDefaultTypeInternal;
-extern ReadExifRequestDefaultTypeInternal _ReadExifRequest_default_instance_;
-class Thumbnail;
-class ThumbnailDefaultTypeInternal;
-extern ThumbnailDefaultTypeInternal _Thumbnail_default_instance_;
-}  // namespace proto
-PROTOBUF_NAMESPACE_OPEN
-template<> ::proto::ClassifyRequest* Arena::CreateMaybeMessage<::proto::ClassifyRequest>(Arena*);
-template<> ::proto::ClassifyResponse* Arena::CreateMaybeMessage<::proto::ClassifyResponse>(Arena*);
-template<> ::proto::ExifInfo* Arena::CreateMaybeMessage<::proto::ExifInfo>(Arena*);
-template<> ::proto::GenerateThumbnailsRequest* Arena::CreateMaybeMessage<::proto::GenerateThumbnailsRequest>(Arena*);
-template<> ::proto::GenerateThumbnailsResponse* Arena::CreateMaybeMessage<::proto::GenerateThumbnailsResponse>(Arena*);
-template<> ::proto::ImageClass* Arena::CreateMaybeMessage<::proto::ImageClass>(Arena*);
-template<> ::proto::ImageInfo* Arena::CreateMaybeMessage<::proto::ImageInfo>(Arena*);
-template<> ::proto::ReadExifRequest* Arena::CreateMaybeMessage<::proto::ReadExifRequest>(Arena*);
-template<> ::proto::Thumbnail* Arena::CreateMaybeMessage<::proto::Thumbnail>(Arena*);
-PROTOBUF_NAMESPACE_CLOSE
-namespace proto {
-
-enum MessageType : int {
-  Ping = 0,
-  GenerateThumbnails = 1,
-  ReadExif = 2,
-  ClassifyImage = 3,
-  MessageType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  MessageType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
-};
-bool MessageType_IsValid(int value);
-constexpr MessageType MessageType_MIN = Ping;
-constexpr MessageType MessageType_MAX = ClassifyImage;
-constexpr int MessageType_ARRAYSIZE = MessageType_MAX + 1;
-
-const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MessageType_descriptor();
-template<typename T>
-inline const std::string& MessageType_Name(T enum_t_value) {
-  static_assert(::std::is_same<T, MessageType>::value ||
-    ::std::is_integral<T>::value,
-    "Incorrect type passed to function MessageType_Name.");
-  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
-    MessageType_descriptor(), enum_t_value);
-}
-inline bool MessageType_Parse(
-    const std::string& name, MessageType* value) {
-  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<MessageType>(
-    MessageType_descriptor(), name, value);
-}
-enum ThumbnailType : int {
-  Small = 0,
-  Medium = 1,
-  Large = 2,
-  ThumbnailType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  ThumbnailType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
-};
-bool ThumbnailType_IsValid(int value);
-constexpr ThumbnailType ThumbnailType_MIN = Small;
-constexpr ThumbnailType ThumbnailType_MAX = Large;
-constexpr int ThumbnailType_ARRAYSIZE = ThumbnailType_MAX + 1;
-
-const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ThumbnailType_descriptor();
-template<typename T>
-inline const std::string& ThumbnailType_Name(T enum_t_value) {
-  static_assert(::std::is_same<T, ThumbnailType>::value ||
-    ::std::is_integral<T>::value,
-    "Incorrect type passed to function ThumbnailType_Name.");
-  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
-    ThumbnailType_descriptor(), enum_t_value);
-}
-inline bool ThumbnailType_Parse(
-    const std::string& name, ThumbnailType* value) {
-  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ThumbnailType>(
-    ThumbnailType_descriptor(), name, value);
-}
-// ===================================================================
-
-class GenerateThumbnailsRequest :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.GenerateThumbnailsRequest) */ {
- public:
-  GenerateThumbnailsRequest();
-  virtual ~GenerateThumbnailsRequest();
-
-  GenerateThumbnailsRequest(const GenerateThumbnailsRequest& from);
-  GenerateThumbnailsRequest(GenerateThumbnailsRequest&& from) noexcept
-    : GenerateThumbnailsRequest() {
-    *this = ::std::move(from);
-  }
-
-  inline GenerateThumbnailsRequest& operator=(const GenerateThumbnailsRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline GenerateThumbnailsRequest& operator=(GenerateThumbnailsRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
-  }
-  static const GenerateThumbnailsRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const GenerateThumbnailsRequest* internal_default_instance() {
-    return reinterpret_cast<const GenerateThumbnailsRequest*>(
-               &_GenerateThumbnailsRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    0;
-
-  friend void swap(GenerateThumbnailsRequest& a, GenerateThumbnailsRequest& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(GenerateThumbnailsRequest* other) {
-    if (other == this) return;
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  inline GenerateThumbnailsRequest* New() const final {
-    return CreateMaybeMessage<GenerateThumbnailsRequest>(nullptr);
-  }
-
-  GenerateThumbnailsRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<GenerateThumbnailsRequest>(arena);
-  }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const GenerateThumbnailsRequest& from);
-  void MergeFrom(const GenerateThumbnailsRequest& from);
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(GenerateThumbnailsRequest* other);
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "proto.GenerateThumbnailsRequest";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
-  public:
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_ipc_2eproto);
-    return ::descriptor_table_ipc_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
-
-  public:
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kTypesFieldNumber = 3,
-    kPathFieldNumber = 1,
-    kOutDirFieldNumber = 2,
-  };
-  // repeated .proto.ThumbnailType types = 3;
-  int types_size() const;
-  private:
-  int _internal_types_size() const;
-  public:
-  void clear_types();
-  private:
-  ::proto::ThumbnailType _internal_types(int index) const;
-  void _internal_add_types(::proto::ThumbnailType value);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* _internal_mutable_types();
-  public:
-  ::proto::ThumbnailType types(int index) const;
-  void set_types(int index, ::proto::ThumbnailType value);
-  void add_types(::proto::ThumbnailType value);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>& types() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* mutable_types();
-
-  // string path = 1;
-  void clear_path();
-  const std::string& path() const;
-  void set_path(const std::string& value);
-  void set_path(std::string&& value);
-  void set_path(const char* value);
-  void set_path(const char* value, size_t size);
-  std::string* mutable_path();
-  std::string* release_path();
-  void set_allocated_path(std::string* path);
-  private:
-  const std::string& _internal_path() const;
-  void _internal_set_path(const std::string& value);
-  std::string* _internal_mutable_path();
-  public:
-
-  // string out_dir = 2;
-  void clear_out_dir();
-  const std::string& out_dir() const;
-  void set_out_dir(const std::string& value);
-  void set_out_dir(std::string&& value);
-  void set_out_dir(const char* value);
-  void set_out_dir(const char* value, size_t size);
-  std::string* mutable_out_dir();
-  std::string* release_out_dir();
-  void set_allocated_out_dir(std::string* out_dir);
-  private:
-  const std::string& _internal_out_dir() const;
-  void _internal_set_out_dir(const std::string& value);
-  std::string* _internal_mutable_out_dir();
-  public:
-
-  // @@protoc_insertion_point(class_scope:proto.GenerateThumbnailsRequest)
- private:
-  class _Internal;
-
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int> types_;
-  mutable std::atomic<int> _types_cached_byte_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr out_dir_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_ipc_2eproto;
-};
-// -------------------------------------------------------------------
-
-class Thumbnail :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.Thumbnail) */ {
- public:
-  Thumbnail();
-  virtual ~Thumbnail();
-
-  Thumbnail(const Thumbnail& from);
-  Thumbnail(Thumbnail&& from) noexcept
-    : Thumbnail() {
-    *this = ::std::move(from);
-  }
-
-  inline Thumbnail& operator=(const Thumbnail& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline Thumbnail& operator=(Thumbnail&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
-  }
-  static const Thumbnail& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const Thumbnail* internal_default_instance() {
-    return reinterpret_cast<const Thumbnail*>(
-               &_Thumbnail_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    1;
-
-  friend void swap(Thumbnail& a, Thumbnail& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(Thumbnail* other) {
-    if (other == this) return;
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  inline Thumbnail* New() const final {
-    return CreateMaybeMessage<Thumbnail>(nullptr);
-  }
-
-  Thumbnail* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<Thumbnail>(arena);
-  }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const Thumbnail& from);
-  void MergeFrom(const Thumbnail& from);
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(Thumbnail* other);
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "proto.Thumbnail";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
-  public:
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_ipc_2eproto);
-    return ::descriptor_table_ipc_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
-
-  public:
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kPathFieldNumber = 2,
-    kTypeFieldNumber = 1,
-    kWidthFieldNumber = 3,
-    kHeightFieldNumber = 4,
-  };
-  // string path = 2;
-  void clear_path();
-  const std::string& path() const;
-  void set_path(const std::string& value);
-  void set_path(std::string&& value);
-  void set_path(const char* value);
-  void set_path(const char* value, size_t size);
-  std::string* mutable_path();
-  std::string* release_path();
-  void set_allocated_path(std::string* path);
-  private:
-  const std::string& _internal_path() const;
-  void _internal_set_path(const std::string& value);
-  std::string* _internal_mutable_path();
-  public:
-
-  // .proto.ThumbnailType type = 1;
-  void clear_type();
-  ::proto::ThumbnailType type() const;
-  void set_type(::proto::ThumbnailType value);
-  private:
-  ::proto::ThumbnailType _internal_type() const;
-  void _internal_set_type(::proto::ThumbnailType value);
-  public:
-
-  // int32 width = 3;
-  void clear_width();
-  ::PROTOBUF_NAMESPACE_ID::int32 width() const;
-  void set_width(::PROTOBUF_NAMESPACE_ID::int32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_width() const;
-  void _internal_set_width(::PROTOBUF_NAMESPACE_ID::int32 value);
-  public:
-
-  // int32 height = 4;
-  void clear_height();
-  ::PROTOBUF_NAMESPACE_ID::int32 height() const;
-  void set_height(::PROTOBUF_NAMESPACE_ID::int32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_height() const;
-  void _internal_set_height(::PROTOBUF_NAMESPACE_ID::int32 value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:proto.Thumbnail)
- private:
-  class _Internal;
-
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
-  int type_;
-  ::PROTOBUF_NAMESPACE_ID::int32 width_;
-  ::PROTOBUF_NAMESPACE_ID::int32 height_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_ipc_2eproto;
-};
-// -------------------------------------------------------------------
-
-class GenerateThumbnailsResponse :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.GenerateThumbnailsResponse) */ {
- public:
-  GenerateThumbnailsResponse();
-  virtual ~GenerateThumbnailsResponse();
-
-  GenerateThumbnailsResponse(const GenerateThumbnailsResponse& from);
-  GenerateThumbnailsResponse(GenerateThumbnailsResponse&& from) noexcept
-    : GenerateThumbnailsResponse() {
-    *this = ::std::move(from);
-  }
-
-  inline GenerateThumbnailsResponse& operator=(const GenerateThumbnailsResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline GenerateThumbnailsResponse& operator=(GenerateThumbnailsResponse&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
-  }
-  static const GenerateThumbnailsResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const GenerateThumbnailsResponse* internal_default_instance() {
-    return reinterpret_cast<const GenerateThumbnailsResponse*>(
-               &_GenerateThumbnailsResponse_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    2;
-
-  friend void swap(GenerateThumbnailsResponse& a, GenerateThumbnailsResponse& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(GenerateThumbnailsResponse* other) {
-    if (other == this) return;
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  inline GenerateThumbnailsResponse* New() const final {
-    return CreateMaybeMessage<GenerateThumbnailsResponse>(nullptr);
-  }
-
-  GenerateThumbnailsResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<GenerateThumbnailsResponse>(arena);
-  }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const GenerateThumbnailsResponse& from);
-  void MergeFrom(const GenerateThumbnailsResponse& from);
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(GenerateThumbnailsResponse* other);
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "proto.GenerateThumbnailsResponse";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
-  public:
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_ipc_2eproto);
-    return ::descriptor_table_ipc_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
-
-  public:
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kDataFieldNumber = 1,
-  };
-  // repeated .proto.Thumbnail data = 1;
-  int data_size() const;
-  private:
-  int _internal_data_size() const;
-  public:
-  void clear_data();
-  ::proto::Thumbnail* mutable_data(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Thumbnail >*
-      mutable_data();
-  private:
-  const ::proto::Thumbnail& _internal_data(int index) const;
-  ::proto::Thumbnail* _internal_add_data();
-  public:
-  const ::proto::Thumbnail& data(int index) const;
-  ::proto::Thumbnail* add_data();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Thumbnail >&
-      data() const;
-
-  // @@protoc_insertion_point(class_scope:proto.GenerateThumbnailsResponse)
- private:
-  class _Internal;
-
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Thumbnail > data_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_ipc_2eproto;
-};
-// -------------------------------------------------------------------
-
-class ReadExifRequest :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.ReadExifRequest) */ {
- public:
-  ReadExifRequest();
-  virtual ~ReadExifRequest();
-
-  ReadExifRequest(const ReadExifRequest& from);
-  ReadExifRequest(ReadExifRequest&& from) noexcept
-    : ReadExifRequest() {
-    *this = ::std::move(from);
-  }
-
-  inline ReadExifRequest& operator=(const ReadExifRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline ReadExifRequest& operator=(ReadExifRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
-  }
-  static const ReadExifRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const ReadExifRequest* internal_default_instance() {
-    return reinterpret_cast<const ReadExifRequest*>(
-               &_ReadExifRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    3;
-
-  friend void swap(ReadExifRequest& a, ReadExifRequest& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(ReadExifRequest* other) {
-    if (other == this) return;
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  inline ReadExifRequest* New() const final {
-    return CreateMaybeMessage<ReadExifRequest>(nullptr);
-  }
-
-  ReadExifRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<ReadExifRequest>(arena);
-  }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const ReadExifRequest& from);
-  void MergeFrom(const ReadExifRequest& from);
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(ReadExifRequest* other);
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "proto.ReadExifRequest";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
-  public:
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_ipc_2eproto);
-    return ::descriptor_table_ipc_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
-
-  public:
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kPathFieldNumber = 1,
-  };
-  // string path = 1;
-  void clear_path();
-  const std::string& path() const;
-  void set_path(const std::string& value);
-  void set_path(std::string&& value);
-  void set_path(const char* value);
-  void set_path(const char* value, size_t size);
-  std::string* mutable_path();
-  std::string* release_path();
-  void set_allocated_path(std::string* path);
-  private:
-  const std::string& _internal_path() const;
-  void _internal_set_path(const std::string& value);
-  std::string* _internal_mutable_path();
-  public:
-
-  // @@protoc_insertion_point(class_scope:proto.ReadExifRequest)
- private:
-  class _Internal;
-
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_ipc_2eproto;
-};
-// -------------------------------------------------------------------
-
-class ExifInfo :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.ExifInfo) */ {
- public:
-  ExifInfo();
-  virtual ~ExifInfo();
-
-  ExifInfo(const ExifInfo& from);
-  ExifInfo(ExifInfo&& from) noexcept
-    : ExifInfo() {
-    *this = ::std::move(from);
-  }
-
-  inline ExifInfo& operator=(const ExifInfo& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline ExifInfo& operator=(ExifInfo&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
-  }
-  static const ExifInfo& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const ExifInfo* internal_default_instance() {
-    return reinterpret_cast<const ExifInfo*>(
-               &_ExifInfo_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    4;
-
-  friend void swap(ExifInfo& a, ExifInfo& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(ExifInfo* other) {
-    if (other == this) return;
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  inline ExifInfo* New() const final {
-    return CreateMaybeMessage<ExifInfo>(nullptr);
-  }
-
-  ExifInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<ExifInfo>(arena);
-  }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const ExifInfo& from);
-  void MergeFrom(const ExifInfo& from);
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(ExifInfo* other);
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "proto.ExifInfo";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
-  public:
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_ipc_2eproto);
-    return ::descriptor_table_ipc_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
-
-  public:
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kCameraMakeFieldNumber = 1,
-    kCameraModelFieldNumber = 2,
-    kSoftwareFieldNumber = 3,
-    kImageDescriptionFieldNumber = 7,
-    kImageCopyrightFieldNumber = 9,
-    kImageDatetimeFieldNumber = 10,
-    kOriginalDatetimeFieldNumber = 11,
-    kDigitizeDatetimeFieldNumber = 12,
-    kSubsecondTimeFieldNumber = 13,
-    kBitsPerSampleFieldNumber = 4,
-    kImageWidthFieldNumber = 5,
-    kImageHeightFieldNumber = 6,
-    kImageOrientationFieldNumber = 8,
-    kFStopFieldNumber = 15,
-    kExposureTimeFieldNumber = 14,
-    kIsoSpeedFieldNumber = 16,
-    kSubjectDistanceFieldNumber = 17,
-    kExposureBiasFieldNumber = 18,
-    kFlashUsedFieldNumber = 19,
-    kMeteringModeFieldNumber = 20,
-    kLensFocalLengthFieldNumber = 21,
-    kGpsLatitudeFieldNumber = 23,
-    kGpsLongitudeFieldNumber = 24,
-    kGpsAltitudeFieldNumber = 25,
-    kFocalLength35MmFieldNumber = 22,
-  };
-  // string camera_make = 1;
-  void clear_camera_make();
-  const std::string& camera_make() const;
-  void set_camera_make(const std::string& value);
-  void set_camera_make(std::string&& value);
-  void set_camera_make(const char* value);
-  void set_camera_make(const char* value, size_t size);
-  std::string* mutable_camera_make();
-  std::string* release_camera_make();
-  void set_allocated_camera_make(std::string* camera_make);
-  private:
-  const std::string& _internal_camera_make() const;
-  void _internal_set_camera_make(const std::string& value);
-  std::string* _internal_mutable_camera_make();
-  public:
-
-  // string camera_model = 2;
-  void clear_camera_model();
-  const std::string& camera_model() const;
-  void set_camera_model(const std::string& value);
-  void set_camera_model(std::string&& value);
-  void set_camera_model(const char* value);
-  void set_camera_model(const char* value, size_t size);
-  std::string* mutable_camera_model();
-  std::string* release_camera_model();
-  void set_allocated_camera_model(std::string* camera_model);
-  private:
-  const std::string& _internal_camera_model() const;
-  void _internal_set_camera_model(const std::string& value);
-  std::string* _internal_mutable_camera_model();
-  public:
-
-  // string software = 3;
-  void clear_software();
-  const std::string& software() const;
-  void set_software(const std::string& value);
-  void set_software(std::string&& value);
-  void set_software(const char* value);
-  void set_software(const char* value, size_t size);
-  std::string* mutable_software();
-  std::string* release_software();
-  void set_allocated_software(std::string* software);
-  private:
-  const std::string& _internal_software() const;
-  void _internal_set_software(const std::string& value);
-  std::string* _internal_mutable_software();
-  public:
-
-  // string image_description = 7;
-  void clear_image_description();
-  const std::string& image_description() const;
-  void set_image_description(const std::string& value);
-  void set_image_description(std::string&& value);
-  void set_image_description(const char* value);
-  void set_image_description(const char* value, size_t size);
-  std::string* mutable_image_description();
-  std::string* release_image_description();
-  void set_allocated_image_description(std::string* image_description);
-  private:
-  const std::string& _internal_image_description() const;
-  void _internal_set_image_description(const std::string& value);
-  std::string* _internal_mutable_image_description();
-  public:
-
-  // string image_copyright = 9;
-  void clear_image_copyright();
-  const std::string& image_copyright() const;
-  void set_image_copyright(const std::string& value);
-  void set_image_copyright(std::string&& value);
-  void set_image_copyright(const char* value);
-  void set_image_copyright(const char* value, size_t size);
-  std::string* mutable_image_copyright();
-  std::string* release_image_copyright();
-  void set_allocated_image_copyright(std::string* image_copyright);
-  private:
-  const std::string& _internal_image_copyright() const;
-  void _internal_set_image_copyright(const std::string& value);
-  std::string* _internal_mutable_image_copyright();
-  public:
-
-  // string image_datetime = 10;
-  void clear_image_datetime();
-  const std::string& image_datetime() const;
-  void set_image_datetime(const std::string& value);
-  void set_image_datetime(std::string&& value);
-  void set_image_datetime(const char* value);
-  void set_image_datetime(const char* value, size_t size);
-  std::string* mutable_image_datetime();
-  std::string* release_image_datetime();
-  void set_allocated_image_datetime(std::string* image_datetime);
-  private:
-  const std::string& _internal_image_datetime() const;
-  void _internal_set_image_datetime(const std::string& value);
-  std::string* _internal_mutable_image_datetime();
-  public:
-
-  // string original_datetime = 11;
-  void clear_original_datetime();
-  const std::string& original_datetime() const;
-  void set_original_datetime(const std::string& value);
-  void set_original_datetime(std::string&& value);
-  void set_original_datetime(const char* value);
-  void set_original_datetime(const char* value, size_t size);
-  std::string* mutable_original_datetime();
-  std::string* release_original_datetime();
-  void set_allocated_original_datetime(std::string* original_datetime);
-  private:
-  const std::string& _internal_original_datetime() const;
-  void _internal_set_original_datetime(const std::string& value);
-  std::string* _internal_mutable_original_datetime();
-  public:
-
-  // string digitize_datetime = 12;
-  void clear_digitize_datetime();
-  const std::string& digitize_datetime() const;
-  void set_digitize_datetime(const std::string& value);
-  void set_digitize_datetime(std::string&& value);
-  void set_digitize_datetime(const char* value);
-  void set_digitize_datetime(const char* value, size_t size);
-  std::string* mutable_digitize_datetime();
-  std::string* release_digitize_datetime();
-  void set_allocated_digitize_datetime(std::string* digitize_datetime);
-  private:
-  const std::string& _internal_digitize_datetime() const;
-  void _internal_set_digitize_datetime(const std::string& value);
-  std::string* _internal_mutable_digitize_datetime();
-  public:
-
-  // string subsecond_time = 13;
-  void clear_subsecond_time();
-  const std::string& subsecond_time() const;
-  void set_subsecond_time(const std::string& value);
-  void set_subsecond_time(std::string&& value);
-  void set_subsecond_time(const char* value);
-  void set_subsecond_time(const char* value, size_t size);
-  std::string* mutable_subsecond_time();
-  std::string* release_subsecond_time();
-  void set_allocated_subsecond_time(std::string* subsecond_time);
-  private:
-  const std::string& _internal_subsecond_time() const;
-  void _internal_set_subsecond_time(const std::string& value);
-  std::string* _internal_mutable_subsecond_time();
-  public:
-
-  // uint32 bits_per_sample = 4;
-  void clear_bits_per_sample();
-  ::PROTOBUF_NAMESPACE_ID::uint32 bits_per_sample() const;
-  void set_bits_per_sample(::PROTOBUF_NAMESPACE_ID::uint32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_bits_per_sample() const;
-  void _internal_set_bits_per_sample(::PROTOBUF_NAMESPACE_ID::uint32 value);
-  public:
-
-  // uint32 image_width = 5;
-  void clear_image_width();
-  ::PROTOBUF_NAMESPACE_ID::uint32 image_width() const;
-  void set_image_width(::PROTOBUF_NAMESPACE_ID::uint32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_image_width() const;
-  void _internal_set_image_width(::PROTOBUF_NAMESPACE_ID::uint32 value);
-  public:
-
-  // uint32 image_height = 6;
-  void clear_image_height();
-  ::PROTOBUF_NAMESPACE_ID::uint32 image_height() const;
-  void set_image_height(::PROTOBUF_NAMESPACE_ID::uint32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_image_height() const;
-  void _internal_set_image_height(::PROTOBUF_NAMESPACE_ID::uint32 value);
-  public:
-
-  // uint32 image_orientation = 8;
-  void clear_image_orientation();
-  ::PROTOBUF_NAMESPACE_ID::uint32 image_orientation() const;
-  void set_image_orientation(::PROTOBUF_NAMESPACE_ID::uint32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_image_orientation() const;
-  void _internal_set_image_orientation(::PROTOBUF_NAMESPACE_ID::uint32 value);
-  public:
-
-  // double f_stop = 15;
-  void clear_f_stop();
-  double f_stop() const;
-  void set_f_stop(double value);
-  private:
-  double _internal_f_stop() const;
-  void _internal_set_f_stop(double value);
-  public:
-
-  // int32 exposure_time = 14;
-  void clear_exposure_time();
-  ::PROTOBUF_NAMESPACE_ID::int32 exposure_time() const;
-  void set_exposure_time(::PROTOBUF_NAMESPACE_ID::int32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_exposure_time() const;
-  void _internal_set_exposure_time(::PROTOBUF_NAMESPACE_ID::int32 value);
-  public:
-
-  // uint32 iso_speed = 16;
-  void clear_iso_speed();
-  ::PROTOBUF_NAMESPACE_ID::uint32 iso_speed() const;
-  void set_iso_speed(::PROTOBUF_NAMESPACE_ID::uint32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_iso_speed() const;
-  void _internal_set_iso_speed(::PROTOBUF_NAMESPACE_ID::uint32 value);
-  public:
-
-  // double subject_distance = 17;
-  void clear_subject_distance();
-  double subject_distance() const;
-  void set_subject_distance(double value);
-  private:
-  double _internal_subject_distance() const;
-  void _internal_set_subject_distance(double value);
-  public:
-
-  // double exposure_bias = 18;
-  void clear_exposure_bias();
-  double exposure_bias() const;
-  void set_exposure_bias(double value);
-  private:
-  double _internal_exposure_bias() const;
-  void _internal_set_exposure_bias(double value);
-  public:
-
-  // int32 flash_used = 19;
-  void clear_flash_used();
-  ::PROTOBUF_NAMESPACE_ID::int32 flash_used() const;
-  void set_flash_used(::PROTOBUF_NAMESPACE_ID::int32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_flash_used() const;
-  void _internal_set_flash_used(::PROTOBUF_NAMESPACE_ID::int32 value);
-  public:
-
-  // uint32 metering_mode = 20;
-  void clear_metering_mode();
-  ::PROTOBUF_NAMESPACE_ID::uint32 metering_mode() const;
-  void set_metering_mode(::PROTOBUF_NAMESPACE_ID::uint32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_metering_mode() const;
-  void _internal_set_metering_mode(::PROTOBUF_NAMESPACE_ID::uint32 value);
-  public:
-
-  // double lens_focal_length = 21;
-  void clear_lens_focal_length();
-  double lens_focal_length() const;
-  void set_lens_focal_length(double value);
-  private:
-  double _internal_lens_focal_length() const;
-  void _internal_set_lens_focal_length(double value);
-  public:
-
-  // double gps_latitude = 23;
-  void clear_gps_latitude();
-  double gps_latitude() const;
-  void set_gps_latitude(double value);
-  private:
-  double _internal_gps_latitude() const;
-  void _internal_set_gps_latitude(double value);
-  public:
-
-  // double gps_longitude = 24;
-  void clear_gps_longitude();
-  double gps_longitude() const;
-  void set_gps_longitude(double value);
-  private:
-  double _internal_gps_longitude() const;
-  void _internal_set_gps_longitude(double value);
-  public:
-
-  // double gps_altitude = 25;
-  void clear_gps_altitude();
-  double gps_altitude() const;
-  void set_gps_altitude(double value);
-  private:
-  double _internal_gps_altitude() const;
-  void _internal_set_gps_altitude(double value);
-  public:
-
-  // uint32 focal_length_35mm = 22;
-  void clear_focal_length_35mm();
-  ::PROTOBUF_NAMESPACE_ID::uint32 focal_length_35mm() const;
-  void set_focal_length_35mm(::PROTOBUF_NAMESPACE_ID::uint32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_focal_length_35mm() const;
-  void _internal_set_focal_length_35mm(::PROTOBUF_NAMESPACE_ID::uint32 value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:proto.ExifInfo)
- private:
-  class _Internal;
-
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr camera_make_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr camera_model_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr software_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr image_description_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr image_copyright_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr image_datetime_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr original_datetime_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr digitize_datetime_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr subsecond_time_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 bits_per_sample_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 image_width_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 image_height_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 image_orientation_;
-  double f_stop_;
-  ::PROTOBUF_NAMESPACE_ID::int32 exposure_time_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 iso_speed_;
-  double subject_distance_;
-  double exposure_bias_;
-  ::PROTOBUF_NAMESPACE_ID::int32 flash_used_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 metering_mode_;
-  double lens_focal_length_;
-  double gps_latitude_;
-  double gps_longitude_;
-  double gps_altitude_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 focal_length_35mm_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_ipc_2eproto;
-};
-// -------------------------------------------------------------------
-
-class ImageInfo :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.ImageInfo) */ {
- public:
-  ImageInfo();
-  virtual ~ImageInfo();
-
-  ImageInfo(const ImageInfo& from);
-  ImageInfo(ImageInfo&& from) noexcept
-    : ImageInfo() {
-    *this = ::std::move(from);
-  }
-
-  inline ImageInfo& operator=(const ImageInfo& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline ImageInfo& operator=(ImageInfo&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
-  }
-  static const ImageInfo& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const ImageInfo* internal_default_instance() {
-    return reinterpret_cast<const ImageInfo*>(
-               &_ImageInfo_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    5;
-
-  friend void swap(ImageInfo& a, ImageInfo& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(ImageInfo* other) {
-    if (other == this) return;
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  inline ImageInfo* New() const final {
-    return CreateMaybeMessage<ImageInfo>(nullptr);
-  }
-
-  ImageInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<ImageInfo>(arena);
-  }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const ImageInfo& from);
-  void MergeFrom(const ImageInfo& from);
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(ImageInfo* other);
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "proto.ImageInfo";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
-  public:
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_ipc_2eproto);
-    return ::descriptor_table_ipc_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
-
-  public:
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kThumbnailFieldNumber = 2,
-    kSourcePathFieldNumber = 1,
-  };
-  // repeated .proto.Thumbnail thumbnail = 2;
-  int thumbnail_size() const;
-  private:
-  int _internal_thumbnail_size() const;
-  public:
-  void clear_thumbnail();
-  ::proto::Thumbnail* mutable_thumbnail(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Thumbnail >*
-      mutable_thumbnail();
-  private:
-  const ::proto::Thumbnail& _internal_thumbnail(int index) const;
-  ::proto::Thumbnail* _internal_add_thumbnail();
-  public:
-  const ::proto::Thumbnail& thumbnail(int index) const;
-  ::proto::Thumbnail* add_thumbnail();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Thumbnail >&
-      thumbnail() const;
-
-  // string source_path = 1;
-  void clear_source_path();
-  const std::string& source_path() const;
-  void set_source_path(const std::string& value);
-  void set_source_path(std::string&& value);
-  void set_source_path(const char* value);
-  void set_source_path(const char* value, size_t size);
-  std::string* mutable_source_path();
-  std::string* release_source_path();
-  void set_allocated_source_path(std::string* source_path);
-  private:
-  const std::string& _internal_source_path() const;
-  void _internal_set_source_path(const std::string& value);
-  std::string* _internal_mutable_source_path();
-  public:
-
-  // @@protoc_insertion_point(class_scope:proto.ImageInfo)
- private:
-  class _Internal;
-
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Thumbnail > thumbnail_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr source_path_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_ipc_2eproto;
-};
-// -------------------------------------------------------------------
-
-class ClassifyRequest :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.ClassifyRequest) */ {
- public:
-  ClassifyRequest();
-  virtual ~ClassifyRequest();
-
-  ClassifyRequest(const ClassifyRequest& from);
-  ClassifyRequest(ClassifyRequest&& from) noexcept
-    : ClassifyRequest() {
-    *this = ::std::move(from);
-  }
-
-  inline ClassifyRequest& operator=(const ClassifyRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline ClassifyRequest& operator=(ClassifyRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
-  }
-  static const ClassifyRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const ClassifyRequest* internal_default_instance() {
-    return reinterpret_cast<const ClassifyRequest*>(
-               &_ClassifyRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    6;
-
-  friend void swap(ClassifyRequest& a, ClassifyRequest& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(ClassifyRequest* other) {
-    if (other == this) return;
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  inline ClassifyRequest* New() const final {
-    return CreateMaybeMessage<ClassifyRequest>(nullptr);
-  }
-
-  ClassifyRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<ClassifyRequest>(arena);
-  }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const ClassifyRequest& from);
-  void MergeFrom(const ClassifyRequest& from);
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(ClassifyRequest* other);
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "proto.ClassifyRequest";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
-  public:
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_ipc_2eproto);
-    return ::descriptor_table_ipc_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
-
-  public:
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kInfosFieldNumber = 1,
-  };
-  // repeated .proto.ImageInfo infos = 1;
-  int infos_size() const;
-  private:
-  int _internal_infos_size() const;
-  public:
-  void clear_infos();
-  ::proto::ImageInfo* mutable_infos(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::ImageInfo >*
-      mutable_infos();
-  private:
-  const ::proto::ImageInfo& _internal_infos(int index) const;
-  ::proto::ImageInfo* _internal_add_infos();
-  public:
-  const ::proto::ImageInfo& infos(int index) const;
-  ::proto::ImageInfo* add_infos();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::ImageInfo >&
-      infos() const;
-
-  // @@protoc_insertion_point(class_scope:proto.ClassifyRequest)
- private:
-  class _Internal;
-
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::ImageInfo > infos_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_ipc_2eproto;
-};
-// -------------------------------------------------------------------
-
-class ImageClass :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.ImageClass) */ {
- public:
-  ImageClass();
-  virtual ~ImageClass();
-
-  ImageClass(const ImageClass& from);
-  ImageClass(ImageClass&& from) noexcept
-    : ImageClass() {
-    *this = ::std::move(from);
-  }
-
-  inline ImageClass& operator=(const ImageClass& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline ImageClass& operator=(ImageClass&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
-  }
-  static const ImageClass& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const ImageClass* internal_default_instance() {
-    return reinterpret_cast<const ImageClass*>(
-               &_ImageClass_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    7;
-
-  friend void swap(ImageClass& a, ImageClass& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(ImageClass* other) {
-    if (other == this) return;
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  inline ImageClass* New() const final {
-    return CreateMaybeMessage<ImageClass>(nullptr);
-  }
-
-  ImageClass* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<ImageClass>(arena);
-  }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const ImageClass& from);
-  void MergeFrom(const ImageClass& from);
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(ImageClass* other);
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "proto.ImageClass";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
-  public:
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_ipc_2eproto);
-    return ::descriptor_table_ipc_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
-
-  public:
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kSourcePathFieldNumber = 1,
-    kClassNameFieldNumber = 2,
-    kClassConfidenceFieldNumber = 3,
-  };
-  // string source_path = 1;
-  void clear_source_path();
-  const std::string& source_path() const;
-  void set_source_path(const std::string& value);
-  void set_source_path(std::string&& value);
-  void set_source_path(const char* value);
-  void set_source_path(const char* value, size_t size);
-  std::string* mutable_source_path();
-  std::string* release_source_path();
-  void set_allocated_source_path(std::string* source_path);
-  private:
-  const std::string& _internal_source_path() const;
-  void _internal_set_source_path(const std::string& value);
-  std::string* _internal_mutable_source_path();
-  public:
-
-  // string class_name = 2;
-  void clear_class_name();
-  const std::string& class_name() const;
-  void set_class_name(const std::string& value);
-  void set_class_name(std::string&& value);
-  void set_class_name(const char* value);
-  void set_class_name(const char* value, size_t size);
-  std::string* mutable_class_name();
-  std::string* release_class_name();
-  void set_allocated_class_name(std::string* class_name);
-  private:
-  const std::string& _internal_class_name() const;
-  void _internal_set_class_name(const std::string& value);
-  std::string* _internal_mutable_class_name();
-  public:
-
-  // float class_confidence = 3;
-  void clear_class_confidence();
-  float class_confidence() const;
-  void set_class_confidence(float value);
-  private:
-  float _internal_class_confidence() const;
-  void _internal_set_class_confidence(float value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:proto.ImageClass)
- private:
-  class _Internal;
-
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr source_path_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr class_name_;
-  float class_confidence_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_ipc_2eproto;
-};
-// -------------------------------------------------------------------
-
-class ClassifyResponse :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto.ClassifyResponse) */ {
- public:
-  ClassifyResponse();
-  virtual ~ClassifyResponse();
-
-  ClassifyResponse(const ClassifyResponse& from);
-  ClassifyResponse(ClassifyResponse&& from) noexcept
-    : ClassifyResponse() {
-    *this = ::std::move(from);
-  }
-
-  inline ClassifyResponse& operator=(const ClassifyResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline ClassifyResponse& operator=(ClassifyResponse&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
-  }
-  static const ClassifyResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const ClassifyResponse* internal_default_instance() {
-    return reinterpret_cast<const ClassifyResponse*>(
-               &_ClassifyResponse_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    8;
-
-  friend void swap(ClassifyResponse& a, ClassifyResponse& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(ClassifyResponse* other) {
-    if (other == this) return;
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  inline ClassifyResponse* New() const final {
-    return CreateMaybeMessage<ClassifyResponse>(nullptr);
-  }
-
-  ClassifyResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<ClassifyResponse>(arena);
-  }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const ClassifyResponse& from);
-  void MergeFrom(const ClassifyResponse& from);
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(ClassifyResponse* other);
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "proto.ClassifyResponse";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
-  public:
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_ipc_2eproto);
-    return ::descriptor_table_ipc_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
-
-  public:
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kResultsFieldNumber = 2,
-    kStatusFieldNumber = 1,
-  };
-  // repeated .proto.ImageClass results = 2;
-  int results_size() const;
-  private:
-  int _internal_results_size() const;
-  public:
-  void clear_results();
-  ::proto::ImageClass* mutable_results(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::ImageClass >*
-      mutable_results();
-  private:
-  const ::proto::ImageClass& _internal_results(int index) const;
-  ::proto::ImageClass* _internal_add_results();
-  public:
-  const ::proto::ImageClass& results(int index) const;
-  ::proto::ImageClass* add_results();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::ImageClass >&
-      results() const;
-
-  // string status = 1;
-  void clear_status();
-  const std::string& status() const;
-  void set_status(const std::string& value);
-  void set_status(std::string&& value);
-  void set_status(const char* value);
-  void set_status(const char* value, size_t size);
-  std::string* mutable_status();
-  std::string* release_status();
-  void set_allocated_status(std::string* status);
-  private:
-  const std::string& _internal_status() const;
-  void _internal_set_status(const std::string& value);
-  std::string* _internal_mutable_status();
-  public:
-
-  // @@protoc_insertion_point(class_scope:proto.ClassifyResponse)
- private:
-  class _Internal;
-
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::ImageClass > results_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr status_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_ipc_2eproto;
-};
-// ===================================================================
-
-
-// ===================================================================
-
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// GenerateThumbnailsRequest
-
-// string path = 1;
-inline void GenerateThumbnailsRequest::clear_path() {
-  path_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline const std::string& GenerateThumbnailsRequest::path() const {
-  // @@protoc_insertion_point(field_get:proto.GenerateThumbnailsRequest.path)
-  return _internal_path();
-}
-inline void GenerateThumbnailsRequest::set_path(const std::string& value) {
-  _internal_set_path(value);
-  // @@protoc_insertion_point(field_set:proto.GenerateThumbnailsRequest.path)
-}
-inline std::string* GenerateThumbnailsRequest::mutable_path() {
-  // @@protoc_insertion_point(field_mutable:proto.GenerateThumbnailsRequest.path)
-  return _internal_mutable_path();
-}
-inline const std::string& GenerateThumbnailsRequest::_internal_path() const {
-  return path_.GetNoArena();
-}
-inline void GenerateThumbnailsRequest::_internal_set_path(const std::string& value) {
-  
-  path_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void GenerateThumbnailsRequest::set_path(std::string&& value) {
-  
-  path_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:proto.GenerateThumbnailsRequest.path)
-}
-inline void GenerateThumbnailsRequest::set_path(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  path_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:proto.GenerateThumbnailsRequest.path)
-}
-inline void GenerateThumbnailsRequest::set_path(const char* value, size_t size) {
-  
-  path_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:proto.GenerateThumbnailsRequest.path)
-}
-inline std::string* GenerateThumbnailsRequest::_internal_mutable_path() {
-  
-  return path_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline std::string* GenerateThumbnailsRequest::release_path() {
-  // @@protoc_insertion_point(field_release:proto.GenerateThumbnailsRequest.path)
-  
-  return path_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline void GenerateThumbnailsRequest::set_allocated_path(std::string* path) {
-  if (path != nullptr) {
-    
-  } else {
-    
-  }
-  path_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), path);
-  // @@protoc_insertion_point(field_set_allocated:proto.GenerateThumbnailsRequest.path)
-}
-
-// string out_dir = 2;
-inline void GenerateThumbnailsRequest::clear_out_dir() {
-  out_dir_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline const std::string& GenerateThumbnailsRequest::out_dir() const {
-  // @@protoc_insertion_point(field_get:proto.GenerateThumbnailsRequest.out_dir)
-  return _internal_out_dir();
-}
-inline void GenerateThumbnailsRequest::set_out_dir(const std::string& value) {
-  _internal_set_out_dir(value);
-  // @@protoc_insertion_point(field_set:proto.GenerateThumbnailsRequest.out_dir)
-}
-inline std::string* GenerateThumbnailsRequest::mutable_out_dir() {
-  // @@protoc_insertion_point(field_mutable:proto.GenerateThumbnailsRequest.out_dir)
-  return _internal_mutable_out_dir();
-}
-inline const std::string& GenerateThumbnailsRequest::_internal_out_dir() const {
-  return out_dir_.GetNoArena();
-}
-inline void GenerateThumbnailsRequest::_internal_set_out_dir(const std::string& value) {
-  
-  out_dir_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void GenerateThumbnailsRequest::set_out_dir(std::string&& value) {
-  
-  out_dir_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:proto.GenerateThumbnailsRequest.out_dir)
-}
-inline void GenerateThumbnailsRequest::set_out_dir(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  out_dir_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:proto.GenerateThumbnailsRequest.out_dir)
-}
-inline void GenerateThumbnailsRequest::set_out_dir(const char* value, size_t size) {
-  
-  out_dir_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:proto.GenerateThumbnailsRequest.out_dir)
-}
-inline std::string* GenerateThumbnailsRequest::_internal_mutable_out_dir() {
-  
-  return out_dir_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline std::string* GenerateThumbnailsRequest::release_out_dir() {
-  // @@protoc_insertion_point(field_release:proto.GenerateThumbnailsRequest.out_dir)
-  
-  return out_dir_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline void GenerateThumbnailsRequest::set_allocated_out_dir(std::string* out_dir) {
-  if (out_dir != nullptr) {
-    
-  } else {
-    
-  }
-  out_dir_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), out_dir);
-  // @@protoc_insertion_point(field_set_allocated:proto.GenerateThumbnailsRequest.out_dir)
-}
-
-// repeated .proto.ThumbnailType types = 3;
-inline int GenerateThumbnailsRequest::_internal_types_size() const {
-  return types_.size();
-}
-inline int GenerateThumbnailsRequest::types_size() const {
-  return _internal_types_size();
-}
-inline void GenerateThumbnailsRequest::clear_types() {
-  types_.Clear();
-}
-inline ::proto::ThumbnailType GenerateThumbnailsRequest::_internal_types(int index) const {
-  return static_cast< ::proto::ThumbnailType >(types_.Get(index));
-}
-inline ::proto::ThumbnailType GenerateThumbnailsRequest::types(int index) const {
-  // @@protoc_insertion_point(field_get:proto.GenerateThumbnailsRequest.types)
-  return _internal_types(index);
-}
-inline void GenerateThumbnailsRequest::set_types(int index, ::proto::ThumbnailType value) {
-  types_.Set(index, value);
-  // @@protoc_insertion_point(field_set:proto.GenerateThumbnailsRequest.types)
-}
-inline void GenerateThumbnailsRequest::_internal_add_types(::proto::ThumbnailType value) {
-  types_.Add(value);
-}
-inline void GenerateThumbnailsRequest::add_types(::proto::ThumbnailType value) {
-  // @@protoc_insertion_point(field_add:proto.GenerateThumbnailsRequest.types)
-  _internal_add_types(value);
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>&
-GenerateThumbnailsRequest::types() const {
-  // @@protoc_insertion_point(field_list:proto.GenerateThumbnailsRequest.types)
-  return types_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
-GenerateThumbnailsRequest::_internal_mutable_types() {
-  return &types_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
-GenerateThumbnailsRequest::mutable_types() {
-  // @@protoc_insertion_point(field_mutable_list:proto.GenerateThumbnailsRequest.types)
-  return _internal_mutable_types();
-}
-
-// -------------------------------------------------------------------
-
-// Thumbnail
-
-// .proto.ThumbnailType type = 1;
-inline void Thumbnail::clear_type() {
-  type_ = 0;
-}
-inline ::proto::ThumbnailType Thumbnail::_internal_type() const {
-  return static_cast< ::proto::ThumbnailType >(type_);
-}
-inline ::proto::ThumbnailType Thumbnail::type() const {
-  // @@protoc_insertion_point(field_get:proto.Thumbnail.type)
-  return _internal_type();
-}
-inline void Thumbnail::_internal_set_type(::proto::ThumbnailType value) {
-  
-  type_ = value;
-}
-inline void Thumbnail::set_type(::proto::ThumbnailType value) {
-  _internal_set_type(value);
-  // @@protoc_insertion_point(field_set:proto.Thumbnail.type)
-}
-
-// string path = 2;
-inline void Thumbnail::clear_path() {
-  path_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline const std::string& Thumbnail::path() const {
-  // @@protoc_insertion_point(field_get:proto.Thumbnail.path)
-  return _internal_path();
-}
-inline void Thumbnail::set_path(const std::string& value) {
-  _internal_set_path(value);
-  // @@protoc_insertion_point(field_set:proto.Thumbnail.path)
-}
-inline std::string* Thumbnail::mutable_path() {
-  // @@protoc_insertion_point(field_mutable:proto.Thumbnail.path)
-  return _internal_mutable_path();
-}
-inline const std::string& Thumbnail::_internal_path() const {
-  return path_.GetNoArena();
-}
-inline void Thumbnail::_internal_set_path(const std::string& value) {
-  
-  path_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void Thumbnail::set_path(std::string&& value) {
-  
-  path_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:proto.Thumbnail.path)
-}
-inline void Thumbnail::set_path(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  path_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:proto.Thumbnail.path)
-}
-inline void Thumbnail::set_path(const char* value, size_t size) {
-  
-  path_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:proto.Thumbnail.path)
-}
-inline std::string* Thumbnail::_internal_mutable_path() {
-  
-  return path_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline std::string* Thumbnail::release_path() {
-  // @@protoc_insertion_point(field_release:proto.Thumbnail.path)
-  
-  return path_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline void Thumbnail::set_allocated_path(std::string* path) {
-  if (path != nullptr) {
-    
-  } else {
-    
-  }
-  path_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), path);
-  // @@protoc_insertion_point(field_set_allocated:proto.Thumbnail.path)
-}
-
-// int32 width = 3;
-inline void Thumbnail::clear_width() {
-  width_ = 0;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 Thumbnail::_internal_width() const {
-  return width_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 Thumbnail::width() const {
-  // @@protoc_insertion_point(field_get:proto.Thumbnail.width)
-  return _internal_width();
-}
-inline void Thumbnail::_internal_set_width(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  
-  width_ = value;
-}
-inline void Thumbnail::set_width(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_width(value);
-  // @@protoc_insertion_point(field_set:proto.Thumbnail.width)
-}
-
-// int32 height = 4;
-inline void Thumbnail::clear_height() {
-  height_ = 0;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 Thumbnail::_internal_height() const {
-  return height_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 Thumbnail::height() const {
-  // @@protoc_insertion_point(field_get:proto.Thumbnail.height)
-  return _internal_height();
-}
-inline void Thumbnail::_internal_set_height(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  
-  height_ = value;
-}
-inline void Thumbnail::set_height(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_height(value);
-  // @@protoc_insertion_point(field_set:proto.Thumbnail.height)
-}
-
-// -------------------------------------------------------------------
-
-// GenerateThumbnailsResponse
-
-// repeated .proto.Thumbnail data = 1;
-inline int GenerateThumbnailsResponse::_internal_data_size() const {
-  return data_.size();
-}
-inline int GenerateThumbnailsResponse::data_size() const {
-  return _internal_data_size();
-}
-inline void GenerateThumbnailsResponse::clear_data() {
-  data_.Clear();
-}
-inline ::proto::Thumbnail* GenerateThumbnailsResponse::mutable_data(int index) {
-  // @@protoc_insertion_point(field_mutable:proto.GenerateThumbnailsResponse.data)
-  return data_.Mutable(index);
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Thumbnail >*
-GenerateThumbnailsResponse::mutable_data() {
-  // @@protoc_insertion_point(field_mutable_list:proto.GenerateThumbnailsResponse.data)
-  return &data_;
-}
-inline const ::proto::Thumbnail& GenerateThumbnailsResponse::_internal_data(int index) const {
-  return data_.Get(index);
-}
-inline const ::proto::Thumbnail& GenerateThumbnailsResponse::data(int index) const {
-  // @@protoc_insertion_point(field_get:proto.GenerateThumbnailsResponse.data)
-  return _internal_data(index);
-}
-inline ::proto::Thumbnail* GenerateThumbnailsResponse::_internal_add_data() {
-  return data_.Add();
-}
-inline ::proto::Thumbnail* GenerateThumbnailsResponse::add_data() {
-  // @@protoc_insertion_point(field_add:proto.GenerateThumbnailsResponse.data)
-  return _internal_add_data();
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Thumbnail >&
-GenerateThumbnailsResponse::data() const {
-  // @@protoc_insertion_point(field_list:proto.GenerateThumbnailsResponse.data)
-  return data_;
-}
-
-// -------------------------------------------------------------------
-
-// ReadExifRequest
-
-// string path = 1;
-inline void ReadExifRequest::clear_path() {
-  path_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline const std::string& ReadExifRequest::path() const {
-  // @@protoc_insertion_point(field_get:proto.ReadExifRequest.path)
-  return _internal_path();
-}
-inline void ReadExifRequest::set_path(const std::string& value) {
-  _internal_set_path(value);
-  // @@protoc_insertion_point(field_set:proto.ReadExifRequest.path)
-}
-inline std::string* ReadExifRequest::mutable_path() {
-  // @@protoc_insertion_point(field_mutable:proto.ReadExifRequest.path)
-  return _internal_mutable_path();
-}
-inline const std::string& ReadExifRequest::_internal_path() const {
-  return path_.GetNoArena();
-}
-inline void ReadExifRequest::_internal_set_path(const std::string& value) {
-  
-  path_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void ReadExifRequest::set_path(std::string&& value) {
-  
-  path_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:proto.ReadExifRequest.path)
-}
-inline void ReadExifRequest::set_path(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  path_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:proto.ReadExifRequest.path)
-}
-inline void ReadExifRequest::set_path(const char* value, size_t size) {
-  
-  path_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:proto.ReadExifRequest.path)
-}
-inline std::string* ReadExifRequest::_internal_mutable_path() {
-  
-  return path_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline std::string* ReadExifRequest::release_path() {
-  // @@protoc_insertion_point(field_release:proto.ReadExifRequest.path)
-  
-  return path_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline void ReadExifRequest::set_allocated_path(std::string* path) {
-  if (path != nullptr) {
-    
-  } else {
-    
-  }
-  path_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), path);
-  // @@protoc_insertion_point(field_set_allocated:proto.ReadExifRequest.path)
-}
-
-// -------------------------------------------------------------------
-
-// ExifInfo
-
-// string camera_make = 1;
-inline void ExifInfo::clear_camera_make() {
-  camera_make_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline const std::string& ExifInfo::camera_make() const {
-  // @@protoc_insertion_point(field_get:proto.ExifInfo.camera_make)
-  return _internal_camera_make();
-}
-inline void ExifInfo::set_camera_make(const std::string& value) {
-  _internal_set_camera_make(value);
-  // @@protoc_insertion_point(field_set:proto.ExifInfo.camera_make)
-}
-inline std::string* ExifInfo::mutable_camera_make() {
-  // @@protoc_insertion_point(field_mutable:proto.ExifInfo.camera_make)
-  return _internal_mutable_camera_make();
-}
-inline const std::string& ExifInfo::_internal_camera_make() const {
-  return camera_make_.GetNoArena();
-}
-inline void ExifInfo::_internal_set_camera_make(const std::string& value) {
-  
-  camera_make_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void ExifInfo::set_camera_make(std::string&& value) {
-  
-  camera_make_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:proto.ExifInfo.camera_make)
-}
-inline void ExifInfo::set_camera_make(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  camera_make_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:proto.ExifInfo.camera_make)
-}
-inline void ExifInfo::set_camera_make(const char* value, size_t size) {
-  
-  camera_make_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:proto.ExifInfo.camera_make)
-}
-inline std::string* ExifInfo::_internal_mutable_camera_make() {
-  
-  return camera_make_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline std::string* ExifInfo::release_camera_make() {
-  // @@protoc_insertion_point(field_release:proto.ExifInfo.camera_make)
-  
-  return camera_make_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline void ExifInfo::set_allocated_camera_make(std::string* camera_make) {
-  if (camera_make != nullptr) {
-    
-  } else {
-    
-  }
-  camera_make_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), camera_make);
-  // @@protoc_insertion_point(field_set_allocated:proto.ExifInfo.camera_make)
-}
-
-// string camera_model = 2;
-inline void ExifInfo::clear_camera_model() {
-  camera_model_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline const std::string& ExifInfo::camera_model() const {
-  // @@protoc_insertion_point(field_get:proto.ExifInfo.camera_model)
-  return _internal_camera_model();
-}
-inline void ExifInfo::set_camera_model(const std::string& value) {
-  _internal_set_camera_model(value);
-  // @@protoc_insertion_point(field_set:proto.ExifInfo.camera_model)
-}
-inline std::string* ExifInfo::mutable_camera_model() {
-  // @@protoc_insertion_point(field_mutable:proto.ExifInfo.camera_model)
-  return _internal_mutable_camera_model();
-}
-inline const std::string& ExifInfo::_internal_camera_model() const {
-  return camera_model_.GetNoArena();
-}
-inline void ExifInfo::_internal_set_camera_model(const std::string& value) {
-  
-  camera_model_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void ExifInfo::set_camera_model(std::string&& value) {
-  
-  camera_model_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:proto.ExifInfo.camera_model)
-}
-inline void ExifInfo::set_camera_model(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  camera_model_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:proto.ExifInfo.camera_model)
-}
-inline void ExifInfo::set_camera_model(const char* value, size_t size) {
-  
-  camera_model_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:proto.ExifInfo.camera_model)
-}
-inline std::string* ExifInfo::_internal_mutable_camera_model() {
-  
-  return camera_model_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline std::string* ExifInfo::release_camera_model() {
-  // @@protoc_insertion_point(field_release:proto.ExifInfo.camera_model)
-  
-  return camera_model_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline void ExifInfo::set_allocated_camera_model(std::string* camera_model) {
-  if (camera_model != nullptr) {
-    
-  } else {
-    
-  }
-  camera_model_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), camera_model);
-  // @@protoc_insertion_point(field_set_allocated:proto.ExifInfo.camera_model)
-}
-
-// string software = 3;
-inline void ExifInfo::clear_software() {
-  software_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline const std::string& ExifInfo::software() const {
-  // @@protoc_insertion_point(field_get:proto.ExifInfo.software)
-  return _internal_software();
-}
-inline void ExifInfo::set_software(const std::string& value) {
-  _internal_set_software(value);
-  // @@protoc_insertion_point(field_set:proto.ExifInfo.software)
-}
-inline std::string* ExifInfo::mutable_software() {
-  // @@protoc_insertion_point(field_mutable:proto.ExifInfo.software)
-  return _internal_mutable_software();
-}
-inline const std::string& ExifInfo::_internal_software() const {
-  return software_.GetNoArena();
-}
-inline void ExifInfo::_internal_set_software(const std::string& value) {
-  
-  software_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void ExifInfo::set_software(std::string&& value) {
-  
-  software_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:proto.ExifInfo.software)
-}
-inline void ExifInfo::set_software(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  software_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:proto.ExifInfo.software)
-}
-inline void ExifInfo::set_software(const char* value, size_t size) {
-  
-  software_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:proto.ExifInfo.software)
-}
-inline std::string* ExifInfo::_internal_mutable_software() {
-  
-  return software_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline std::string* ExifInfo::release_software() {
-  // @@protoc_insertion_point(field_release:proto.ExifInfo.software)
-  
-  return software_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline void ExifInfo::set_allocated_software(std::string* software) {
-  if (software != nullptr) {
-    
-  } else {
-    
-  }
-  software_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), software);
-  // @@protoc_insertion_point(field_set_allocated:proto.ExifInfo.software)
-}
-
-// uint32 bits_per_sample = 4;
-inline void ExifInfo::clear_bits_per_sample() {
-  bits_per_sample_ = 0u;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint32 ExifInfo::_internal_bits_per_sample() const {
-  return bits_per_sample_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint32 ExifInfo::bits_per_sample() const {
-  // @@protoc_insertion_point(field_get:proto.ExifInfo.bits_per_sample)
-  return _internal_bits_per_sample();
-}
-inline void ExifInfo::_internal_set_bits_per_sample(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  
-  bits_per_sample_ = value;
-}
-inline void ExifInfo::set_bits_per_sample(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _internal_set_bits_per_sample(value);
-  // @@protoc_insertion_point(field_set:proto.ExifInfo.bits_per_sample)
-}
-
-// uint32 image_width = 5;
-inline void ExifInfo::clear_image_width() {
-  image_width_ = 0u;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint32 ExifInfo::_internal_image_width() const {
-  return image_width_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint32 ExifInfo::image_width() const {
-  // @@protoc_insertion_point(field_get:proto.ExifInfo.image_width)
-  return _internal_image_width();
-}
-inline void ExifInfo::_internal_set_image_width(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  
-  image_width_ = value;
-}
-inline void ExifInfo::set_image_width(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _internal_set_image_width(value);
-  // @@protoc_insertion_point(field_set:proto.ExifInfo.image_width)
-}
-
-// uint32 image_height = 6;
-inline void ExifInfo::clear_image_height() {
-  image_height_ = 0u;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint32 ExifInfo::_internal_image_height() const {
-  return image_height_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint32 ExifInfo::image_height() const {
-  // @@protoc_insertion_point(field_get:proto.ExifInfo.image_height)
-  return _internal_image_height();
-}
-inline void ExifInfo::_internal_set_image_height(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  
-  image_height_ = value;
-}
-inline void ExifInfo::set_image_height(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _internal_set_image_height(value);
-  // @@protoc_insertion_point(field_set:proto.ExifInfo.image_height)
-}
-
-// string image_description = 7;
-inline void ExifInfo::clear_image_description() {
-  image_description_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline const std::string& ExifInfo::image_description() const {
-  // @@protoc_insertion_point(field_get:proto.ExifInfo.image_description)
-  return _internal_image_description();
-}
-inline void ExifInfo::set_image_description(const std::string& value) {
-  _internal_set_image_description(value);
-  // @@protoc_insertion_point(field_set:proto.ExifInfo.image_description)
-}
-inline std::string* ExifInfo::mutable_image_description() {
-  // @@protoc_insertion_point(field_mutable:proto.ExifInfo.image_description)
-  return _internal_mutable_image_description();
-}
-inline const std::string& ExifInfo::_internal_image_description() const {
-  return image_description_.GetNoArena();
-}
-inline void ExifInfo::_internal_set_image_description(const std::string& value) {
-  
-  image_description_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void ExifInfo::set_image_description(std::string&& value) {
-  
-  image_description_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:proto.ExifInfo.image_description)
-}
-inline void ExifInfo::set_image_description(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  image_description_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:proto.ExifInfo.image_description)
-}
-inline void ExifInfo::set_image_description(const char* value, size_t size) {
-  
-  image_description_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:proto.ExifInfo.image_description)
-}
-inline std::string* ExifInfo::_internal_mutable_image_description() {
-  
-  return image_description_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline std::string* ExifInfo::release_image_description() {
-  // @@protoc_insertion_point(field_release:proto.ExifInfo.image_description)
-  
-  return image_description_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline void ExifInfo::set_allocated_image_description(std::string* image_description) {
-  if (image_description != nullptr) {
-    
-  } else {
-    
-  }
-  image_description_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), image_description);
-  // @@protoc_insertion_point(field_set_allocated:proto.ExifInfo.image_description)
-}
-
-// uint32 image_orientation = 8;
-inline void ExifInfo::clear_image_orientation() {
-  image_orientation_ = 0u;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint32 ExifInfo::_internal_image_orientation() const {
-  return image_orientation_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint32 ExifInfo::image_orientation() const {
-  // @@protoc_insertion_point(field_get:proto.ExifInfo.image_orientation)
-  return _internal_image_orientation();
-}
-inline void ExifInfo::_internal_set_image_orientation(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  
-  image_orientation_ = value;
-}
-inline void ExifInfo::set_image_orientation(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _internal_set_image_orientation(value);
-  // @@protoc_insertion_point(field_set:proto.ExifInfo.image_orientation)
-}
-
-// string image_copyright = 9;
-inline void ExifInfo::clear_image_copyright() {
-  image_copyright_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline const std::string& ExifInfo::image_copyright() const {
-  // @@protoc_insertion_point(field_get:proto.ExifInfo.image_copyright)
-  return _internal_image_copyright();
-}
-inline void ExifInfo::set_image_copyright(const std::string& value) {
-  _internal_set_image_copyright(value);
-  // @@protoc_insertion_point(field_set:proto.ExifInfo.image_copyright)
-}
-inline std::string* ExifInfo::mutable_image_copyright() {
-  // @@protoc_insertion_point(field_mutable:proto.ExifInfo.image_copyright)
-  return _internal_mutable_image_copyright();
-}
-inline const std::string& ExifInfo::_internal_image_copyright() const {
-  return image_copyright_.GetNoArena();
-}
-inline void ExifInfo::_internal_set_image_copyright(const std::string& value) {
-  
-  image_copyright_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void ExifInfo::set_image_copyright(std::string&& value) {
-  
-  image_copyright_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:proto.ExifInfo.image_copyright)
-}
-inline void ExifInfo::set_image_copyright(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  image_copyright_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:proto.ExifInfo.image_copyright)
-}
-inline void ExifInfo::set_image_copyright(const char* value, size_t size) {
-  
-  image_copyright_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:proto.ExifInfo.image_copyright)
-}
-inline std::string* ExifInfo::_internal_mutable_image_copyright() {
-  
-  return image_copyright_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline std::string* ExifInfo::release_image_copyright() {
-  // @@protoc_insertion_point(field_release:proto.ExifInfo.image_copyright)
-  
-  return image_copyright_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline void ExifInfo::set_allocated_image_copyright(std::string* image_copyright) {
-  if (image_copyright != nullptr) {
-    
-  } else {
-    
-  }
-  image_copyright_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), image_copyright);
-  // @@protoc_insertion_point(field_set_allocated:proto.ExifInfo.image_copyright)
-}
-
-// string image_datetime = 10;
-inline void ExifInfo::clear_image_datetime() {
-  image_datetime_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline const std::string& ExifInfo::image_datetime() const {
-  // @@protoc_insertion_point(field_get:proto.ExifInfo.image_datetime)
-  return _internal_image_datetime();
-}
-inline void ExifInfo::set_image_datetime(const std::string& value) {
-  _internal_set_image_datetime(value);
-  // @@protoc_insertion_point(field_set:proto.ExifInfo.image_datetime)
-}
-inline std::string* ExifInfo::mutable_image_datetime() {
-  // @@protoc_insertion_point(field_mutable:proto.ExifInfo.image_datetime)
-  return _internal_mutable_image_datetime();
-}
-inline const std::string& ExifInfo::_internal_image_datetime() const {
-  return image_datetime_.GetNoArena();
-}
-inline void ExifInfo::_internal_set_image_datetime(const std::string& value) {
-  
-  image_datetime_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void ExifInfo::set_image_datetime(std::string&& value) {
-  
-  image_datetime_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:proto.ExifInfo.image_datetime)
-}
-inline void ExifInfo::set_image_datetime(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  image_datetime_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:proto.ExifInfo.image_datetime)
-}
-inline void ExifInfo::set_image_datetime(const char* value, size_t size) {
-  
-  image_datetime_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:proto.ExifInfo.image_datetime)
-}
-inline std::string* ExifInfo::_internal_mutable_image_datetime() {
-  
-  return image_datetime_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline std::string* ExifInfo::release_image_datetime() {
-  // @@protoc_insertion_point(field_release:proto.ExifInfo.image_datetime)
-  
-  return image_datetime_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline void ExifInfo::set_allocated_image_datetime(std::string* image_datetime) {
-  if (image_datetime != nullptr) {
-    
-  } else {
-    
-  }
-  image_datetime_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), image_datetime);
-  // @@protoc_insertion_point(field_set_allocated:proto.ExifInfo.image_datetime)
-}
-
-// string original_datetime = 11;
-inline void ExifInfo::clear_original_datetime() {
-  original_datetime_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline const std::string& ExifInfo::original_datetime() const {
-  // @@protoc_insertion_point(field_get:proto.ExifInfo.original_datetime)
-  return _internal_original_datetime();
-}
-inline void ExifInfo::set_original_datetime(const std::string& value) {
-  _internal_set_original_datetime(value);
-  // @@protoc_insertion_point(field_set:proto.ExifInfo.original_datetime)
-}
-inline std::string* ExifInfo::mutable_original_datetime() {
-  // @@protoc_insertion_point(field_mutable:proto.ExifInfo.original_datetime)
-  return _internal_mutable_original_datetime();
-}
-inline const std::string& ExifInfo::_internal_original_datetime() const {
-  return original_datetime_.GetNoArena();
-}
-inline void ExifInfo::_internal_set_original_datetime(const std::string& value) {
-  
-  original_datetime_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void ExifInfo::set_original_datetime(std::string&& value) {
-  
-  original_datetime_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:proto.ExifInfo.original_datetime)
-}
-inline void ExifInfo::set_original_datetime(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  original_datetime_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:proto.ExifInfo.original_datetime)
-}
-inline void ExifInfo::set_original_datetime(const char* value, size_t size) {
-  
-  original_datetime_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:proto.ExifInfo.original_datetime)
-}
-inline std::string* ExifInfo::_internal_mutable_original_datetime() {
-  
-  return original_datetime_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline std::string* ExifInfo::release_original_datetime() {
-  // @@protoc_insertion_point(field_release:proto.ExifInfo.original_datetime)
-  
-  return original_datetime_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline void ExifInfo::set_allocated_original_datetime(std::string* original_datetime) {
-  if (original_datetime != nullptr) {
-    
-  } else {
-    
-  }
-  original_datetime_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), original_datetime);
-  // @@protoc_insertion_point(field_set_allocated:proto.ExifInfo.original_datetime)
-}
-
-// string digitize_datetime = 12;
-inline void ExifInfo::clear_digitize_datetime() {
-  digitize_datetime_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline const std::string& ExifInfo::digitize_datetime() const {
-  // @@protoc_insertion_point(field_get:proto.ExifInfo.digitize_datetime)
-  return _internal_digitize_datetime();
-}
-inline void ExifInfo::set_digitize_datetime(const std::string& value) {
-  _internal_set_digitize_datetime(value);
-  // @@protoc_insertion_point(field_set:proto.ExifInfo.digitize_datetime)
-}
-inline std::string* ExifInfo::mutable_digitize_datetime() {
-  // @@protoc_insertion_point(field_mutable:proto.ExifInfo.digitize_datetime)
-  return _internal_mutable_digitize_datetime();
-}
-inline const std::string& ExifInfo::_internal_digitize_datetime() const {
-  return digitize_datetime_.GetNoArena();
-}
-inline void ExifInfo::_internal_set_digitize_datetime(const std::string& value) {
-  
-  digitize_datetime_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void ExifInfo::set_digitize_datetime(std::string&& value) {
-  
-  digitize_datetime_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:proto.ExifInfo.digitize_datetime)
-}
-inline void ExifInfo::set_digitize_datetime(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  digitize_datetime_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:proto.ExifInfo.digitize_datetime)
-}
-inline void ExifInfo::set_digitize_datetime(const char* value, size_t size) {
-  
-  digitize_datetime_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:proto.ExifInfo.digitize_datetime)
-}
-inline std::string* ExifInfo::_internal_mutable_digitize_datetime() {
-  
-  return digitize_datetime_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline std::string* ExifInfo::release_digitize_datetime() {
-  // @@protoc_insertion_point(field_release:proto.ExifInfo.digitize_datetime)
-  
-  return digitize_datetime_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline void ExifInfo::set_allocated_digitize_datetime(std::string* digitize_datetime) {
-  if (digitize_datetime != nullptr) {
-    
-  } else {
-    
-  }
-  digitize_datetime_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), digitize_datetime);
-  // @@protoc_insertion_point(field_set_allocated:proto.ExifInfo.digitize_datetime)
-}
-
-// string subsecond_time = 13;
-inline void ExifInfo::clear_subsecond_time() {
-  subsecond_time_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline const std::string& ExifInfo::subsecond_time() const {
-  // @@protoc_insertion_point(field_get:proto.ExifInfo.subsecond_time)
-  return _internal_subsecond_time();
-}
-inline void ExifInfo::set_subsecond_time(const std::string& value) {
-  _internal_set_subsecond_time(value);
-  // @@protoc_insertion_point(field_set:proto.ExifInfo.subsecond_time)
-}
-inline std::string* ExifInfo::mutable_subsecond_time() {
-  // @@protoc_insertion_point(field_mutable:proto.ExifInfo.subsecond_time)
-  return _internal_mutable_subsecond_time();
-}
-inline const std::string& ExifInfo::_internal_subsecond_time() const {
-  return subsecond_time_.GetNoArena();
-}
-inline void ExifInfo::_internal_set_subsecond_time(const std::string& value) {
-  
-  subsecond_time_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void ExifInfo::set_subsecond_time(std::string&& value) {
-  
-  subsecond_time_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:proto.ExifInfo.subsecond_time)
-}
-inline void ExifInfo::set_subsecond_time(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  subsecond_time_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:proto.ExifInfo.subsecond_time)
-}
-inline void ExifInfo::set_subsecond_time(const char* value, size_t size) {
-  
-  subsecond_time_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:proto.ExifInfo.subsecond_time)
-}
-inline std::string* ExifInfo::_internal_mutable_subsecond_time() {
-  
-  return subsecond_time_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline std::string* ExifInfo::release_subsecond_time() {
-  // @@protoc_insertion_point(field_release:proto.ExifInfo.subsecond_time)
-  
-  return subsecond_time_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline void ExifInfo::set_allocated_subsecond_time(std::string* subsecond_time) {
-  if (subsecond_time != nullptr) {
-    
-  } else {
-    
-  }
-  subsecond_time_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), subsecond_time);
-  // @@protoc_insertion_point(field_set_allocated:proto.ExifInfo.subsecond_time)
-}
-
-// int32 exposure_time = 14;
-inline void ExifInfo::clear_exposure_time() {
-  exposure_time_ = 0;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 ExifInfo::_internal_exposure_time() const {
-  return exposure_time_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 ExifInfo::exposure_time() const {
-  // @@protoc_insertion_point(field_get:proto.ExifInfo.exposure_time)
-  return _internal_exposure_time();
-}
-inline void ExifInfo::_internal_set_exposure_time(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  
-  exposure_time_ = value;
-}
-inline void ExifInfo::set_exposure_time(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_exposure_time(value);
-  // @@protoc_insertion_point(field_set:proto.ExifInfo.exposure_time)
-}
-
-// double f_stop = 15;
-inline void ExifInfo::clear_f_stop() {
-  f_stop_ = 0;
-}
-inline double ExifInfo::_internal_f_stop() const {
-  return f_stop_;
-}
-inline double ExifInfo::f_stop() const {
-  // @@protoc_insertion_point(field_get:proto.ExifInfo.f_stop)
-  return _internal_f_stop();
-}
-inline void ExifInfo::_internal_set_f_stop(double value) {
-  
-  f_stop_ = value;
-}
-inline void ExifInfo::set_f_stop(double value) {
-  _internal_set_f_stop(value);
-  // @@protoc_insertion_point(field_set:proto.ExifInfo.f_stop)
-}
-
-// uint32 iso_speed = 16;
-inline void ExifInfo::clear_iso_speed() {
-  iso_speed_ = 0u;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint32 ExifInfo::_internal_iso_speed() const {
-  return iso_speed_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint32 ExifInfo::iso_speed() const {
-  // @@protoc_insertion_point(field_get:proto.ExifInfo.iso_speed)
-  return _internal_iso_speed();
-}
-inline void ExifInfo::_internal_set_iso_speed(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  
-  iso_speed_ = value;
-}
-inline void ExifInfo::set_iso_speed(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _internal_set_iso_speed(value);
-  // @@protoc_insertion_point(field_set:proto.ExifInfo.iso_speed)
-}
-
-// double subject_distance = 17;
-inline void ExifInfo::clear_subject_distance() {
-  subject_distance_ = 0;
-}
-inline double ExifInfo::_internal_subject_distance() const {
-  return subject_distance_;
-}
-inline double ExifInfo::subject_distance() const {
-  // @@protoc_insertion_point(field_get:proto.ExifInfo.subject_distance)
-  return _internal_subject_distance();
-}
-inline void ExifInfo::_internal_set_subject_distance(double value) {
-  
-  subject_distance_ = value;
-}
-inline void ExifInfo::set_subject_distance(double value) {
-  _internal_set_subject_distance(value);
-  // @@protoc_insertion_point(field_set:proto.ExifInfo.subject_distance)
-}
-
-// double exposure_bias = 18;
-inline void ExifInfo::clear_exposure_bias() {
-  exposure_bias_ = 0;
-}
-inline double ExifInfo::_internal_exposure_bias() const {
-  return exposure_bias_;
-}
-inline double ExifInfo::exposure_bias() const {
-  // @@protoc_insertion_point(field_get:proto.ExifInfo.exposure_bias)
-  return _internal_exposure_bias();
-}
-inline void ExifInfo::_internal_set_exposure_bias(double value) {
-  
-  exposure_bias_ = value;
-}
-inline void ExifInfo::set_exposure_bias(double value) {
-  _internal_set_exposure_bias(value);
-  // @@protoc_insertion_point(field_set:proto.ExifInfo.exposure_bias)
-}
-
-// int32 flash_used = 19;
-inline void ExifInfo::clear_flash_used() {
-  flash_used_ = 0;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 ExifInfo::_internal_flash_used() const {
-  return flash_used_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 ExifInfo::flash_used() const {
-  // @@protoc_insertion_point(field_get:proto.ExifInfo.flash_used)
-  return _internal_flash_used();
-}
-inline void ExifInfo::_internal_set_flash_used(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  
-  flash_used_ = value;
-}
-inline void ExifInfo::set_flash_used(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_flash_used(value);
-  // @@protoc_insertion_point(field_set:proto.ExifInfo.flash_used)
-}
-
-// uint32 metering_mode = 20;
-inline void ExifInfo::clear_metering_mode() {
-  metering_mode_ = 0u;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint32 ExifInfo::_internal_metering_mode() const {
-  return metering_mode_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint32 ExifInfo::metering_mode() const {
-  // @@protoc_insertion_point(field_get:proto.ExifInfo.metering_mode)
-  return _internal_metering_mode();
-}
-inline void ExifInfo::_internal_set_metering_mode(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  
-  metering_mode_ = value;
-}
-inline void ExifInfo::set_metering_mode(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _internal_set_metering_mode(value);
-  // @@protoc_insertion_point(field_set:proto.ExifInfo.metering_mode)
-}
-
-// double lens_focal_length = 21;
-inline void ExifInfo::clear_lens_focal_length() {
-  lens_focal_length_ = 0;
-}
-inline double ExifInfo::_internal_lens_focal_length() const {
-  return lens_focal_length_;
-}
-inline double ExifInfo::lens_focal_length() const {
-  // @@protoc_insertion_point(field_get:proto.ExifInfo.lens_focal_length)
-  return _internal_lens_focal_length();
-}
-inline void ExifInfo::_internal_set_lens_focal_length(double value) {
-  
-  lens_focal_length_ = value;
-}
-inline void ExifInfo::set_lens_focal_length(double value) {
-  _internal_set_lens_focal_length(value);
-  // @@protoc_insertion_point(field_set:proto.ExifInfo.lens_focal_length)
-}
-
-// uint32 focal_length_35mm = 22;
-inline void ExifInfo::clear_focal_length_35mm() {
-  focal_length_35mm_ = 0u;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint32 ExifInfo::_internal_focal_length_35mm() const {
-  return focal_length_35mm_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint32 ExifInfo::focal_length_35mm() const {
-  // @@protoc_insertion_point(field_get:proto.ExifInfo.focal_length_35mm)
-  return _internal_focal_length_35mm();
-}
-inline void ExifInfo::_internal_set_focal_length_35mm(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  
-  focal_length_35mm_ = value;
-}
-inline void ExifInfo::set_focal_length_35mm(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _internal_set_focal_length_35mm(value);
-  // @@protoc_insertion_point(field_set:proto.ExifInfo.focal_length_35mm)
-}
-
-// double gps_latitude = 23;
-inline void ExifInfo::clear_gps_latitude() {
-  gps_latitude_ = 0;
-}
-inline double ExifInfo::_internal_gps_latitude() const {
-  return gps_latitude_;
-}
-inline double ExifInfo::gps_latitude() const {
-  // @@protoc_insertion_point(field_get:proto.ExifInfo.gps_latitude)
-  return _internal_gps_latitude();
-}
-inline void ExifInfo::_internal_set_gps_latitude(double value) {
-  
-  gps_latitude_ = value;
-}
-inline void ExifInfo::set_gps_latitude(double value) {
-  _internal_set_gps_latitude(value);
-  // @@protoc_insertion_point(field_set:proto.ExifInfo.gps_latitude)
-}
-
-// double gps_longitude = 24;
-inline void ExifInfo::clear_gps_longitude() {
-  gps_longitude_ = 0;
-}
-inline double ExifInfo::_internal_gps_longitude() const {
-  return gps_longitude_;
-}
-inline double ExifInfo::gps_longitude() const {
-  // @@protoc_insertion_point(field_get:proto.ExifInfo.gps_longitude)
-  return _internal_gps_longitude();
-}
-inline void ExifInfo::_internal_set_gps_longitude(double value) {
-  
-  gps_longitude_ = value;
-}
-inline void ExifInfo::set_gps_longitude(double value) {
-  _internal_set_gps_longitude(value);
-  // @@protoc_insertion_point(field_set:proto.ExifInfo.gps_longitude)
-}
-
-// double gps_altitude = 25;
-inline void ExifInfo::clear_gps_altitude() {
-  gps_altitude_ = 0;
-}
-inline double ExifInfo::_internal_gps_altitude() const {
-  return gps_altitude_;
-}
-inline double ExifInfo::gps_altitude() const {
-  // @@protoc_insertion_point(field_get:proto.ExifInfo.gps_altitude)
-  return _internal_gps_altitude();
-}
-inline void ExifInfo::_internal_set_gps_altitude(double value) {
-  
-  gps_altitude_ = value;
-}
-inline void ExifInfo::set_gps_altitude(double value) {
-  _internal_set_gps_altitude(value);
-  // @@protoc_insertion_point(field_set:proto.ExifInfo.gps_altitude)
-}
-
-// -------------------------------------------------------------------
-
-// ImageInfo
-
-// string source_path = 1;
-inline void ImageInfo::clear_source_path() {
-  source_path_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline const std::string& ImageInfo::source_path() const {
-  // @@protoc_insertion_point(field_get:proto.ImageInfo.source_path)
-  return _internal_source_path();
-}
-inline void ImageInfo::set_source_path(const std::string& value) {
-  _internal_set_source_path(value);
-  // @@protoc_insertion_point(field_set:proto.ImageInfo.source_path)
-}
-inline std::string* ImageInfo::mutable_source_path() {
-  // @@protoc_insertion_point(field_mutable:proto.ImageInfo.source_path)
-  return _internal_mutable_source_path();
-}
-inline const std::string& ImageInfo::_internal_source_path() const {
-  return source_path_.GetNoArena();
-}
-inline void ImageInfo::_internal_set_source_path(const std::string& value) {
-  
-  source_path_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void ImageInfo::set_source_path(std::string&& value) {
-  
-  source_path_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:proto.ImageInfo.source_path)
-}
-inline void ImageInfo::set_source_path(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  source_path_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:proto.ImageInfo.source_path)
-}
-inline void ImageInfo::set_source_path(const char* value, size_t size) {
-  
-  source_path_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:proto.ImageInfo.source_path)
-}
-inline std::string* ImageInfo::_internal_mutable_source_path() {
-  
-  return source_path_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline std::string* ImageInfo::release_source_path() {
-  // @@protoc_insertion_point(field_release:proto.ImageInfo.source_path)
-  
-  return source_path_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline void ImageInfo::set_allocated_source_path(std::string* source_path) {
-  if (source_path != nullptr) {
-    
-  } else {
-    
-  }
-  source_path_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), source_path);
-  // @@protoc_insertion_point(field_set_allocated:proto.ImageInfo.source_path)
-}
-
-// repeated .proto.Thumbnail thumbnail = 2;
-inline int ImageInfo::_internal_thumbnail_size() const {
-  return thumbnail_.size();
-}
-inline int ImageInfo::thumbnail_size() const {
-  return _internal_thumbnail_size();
-}
-inline void ImageInfo::clear_thumbnail() {
-  thumbnail_.Clear();
-}
-inline ::proto::Thumbnail* ImageInfo::mutable_thumbnail(int index) {
-  // @@protoc_insertion_point(field_mutable:proto.ImageInfo.thumbnail)
-  return thumbnail_.Mutable(index);
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Thumbnail >*
-ImageInfo::mutable_thumbnail() {
-  // @@protoc_insertion_point(field_mutable_list:proto.ImageInfo.thumbnail)
-  return &thumbnail_;
-}
-inline const ::proto::Thumbnail& ImageInfo::_internal_thumbnail(int index) const {
-  return thumbnail_.Get(index);
-}
-inline const ::proto::Thumbnail& ImageInfo::thumbnail(int index) const {
-  // @@protoc_insertion_point(field_get:proto.ImageInfo.thumbnail)
-  return _internal_thumbnail(index);
-}
-inline ::proto::Thumbnail* ImageInfo::_internal_add_thumbnail() {
-  return thumbnail_.Add();
-}
-inline ::proto::Thumbnail* ImageInfo::add_thumbnail() {
-  // @@protoc_insertion_point(field_add:proto.ImageInfo.thumbnail)
-  return _internal_add_thumbnail();
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Thumbnail >&
-ImageInfo::thumbnail() const {
-  // @@protoc_insertion_point(field_list:proto.ImageInfo.thumbnail)
-  return thumbnail_;
-}
-
-// -------------------------------------------------------------------
-
-// ClassifyRequest
-
-// repeated .proto.ImageInfo infos = 1;
-inline int ClassifyRequest::_internal_infos_size() const {
-  return infos_.size();
-}
-inline int ClassifyRequest::infos_size() const {
-  return _internal_infos_size();
-}
-inline void ClassifyRequest::clear_infos() {
-  infos_.Clear();
-}
-inline ::proto::ImageInfo* ClassifyRequest::mutable_infos(int index) {
-  // @@protoc_insertion_point(field_mutable:proto.ClassifyRequest.infos)
-  return infos_.Mutable(index);
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::ImageInfo >*
-ClassifyRequest::mutable_infos() {
-  // @@protoc_insertion_point(field_mutable_list:proto.ClassifyRequest.infos)
-  return &infos_;
-}
-inline const ::proto::ImageInfo& ClassifyRequest::_internal_infos(int index) const {
-  return infos_.Get(index);
-}
-inline const ::proto::ImageInfo& ClassifyRequest::infos(int index) const {
-  // @@protoc_insertion_point(field_get:proto.ClassifyRequest.infos)
-  return _internal_infos(index);
-}
-inline ::proto::ImageInfo* ClassifyRequest::_internal_add_infos() {
-  return infos_.Add();
-}
-inline ::proto::ImageInfo* ClassifyRequest::add_infos() {
-  // @@protoc_insertion_point(field_add:proto.ClassifyRequest.infos)
-  return _internal_add_infos();
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::ImageInfo >&
-ClassifyRequest::infos() const {
-  // @@protoc_insertion_point(field_list:proto.ClassifyRequest.infos)
-  return infos_;
-}
-
-// -------------------------------------------------------------------
-
-// ImageClass
-
-// string source_path = 1;
-inline void ImageClass::clear_source_path() {
-  source_path_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline const std::string& ImageClass::source_path() const {
-  // @@protoc_insertion_point(field_get:proto.ImageClass.source_path)
-  return _internal_source_path();
-}
-inline void ImageClass::set_source_path(const std::string& value) {
-  _internal_set_source_path(value);
-  // @@protoc_insertion_point(field_set:proto.ImageClass.source_path)
-}
-inline std::string* ImageClass::mutable_source_path() {
-  // @@protoc_insertion_point(field_mutable:proto.ImageClass.source_path)
-  return _internal_mutable_source_path();
-}
-inline const std::string& ImageClass::_internal_source_path() const {
-  return source_path_.GetNoArena();
-}
-inline void ImageClass::_internal_set_source_path(const std::string& value) {
-  
-  source_path_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void ImageClass::set_source_path(std::string&& value) {
-  
-  source_path_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:proto.ImageClass.source_path)
-}
-inline void ImageClass::set_source_path(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  source_path_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:proto.ImageClass.source_path)
-}
-inline void ImageClass::set_source_path(const char* value, size_t size) {
-  
-  source_path_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:proto.ImageClass.source_path)
-}
-inline std::string* ImageClass::_internal_mutable_source_path() {
-  
-  return source_path_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline std::string* ImageClass::release_source_path() {
-  // @@protoc_insertion_point(field_release:proto.ImageClass.source_path)
-  
-  return source_path_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline void ImageClass::set_allocated_source_path(std::string* source_path) {
-  if (source_path != nullptr) {
-    
-  } else {
-    
-  }
-  source_path_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), source_path);
-  // @@protoc_insertion_point(field_set_allocated:proto.ImageClass.source_path)
-}
-
-// string class_name = 2;
-inline void ImageClass::clear_class_name() {
-  class_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline const std::string& ImageClass::class_name() const {
-  // @@protoc_insertion_point(field_get:proto.ImageClass.class_name)
-  return _internal_class_name();
-}
-inline void ImageClass::set_class_name(const std::string& value) {
-  _internal_set_class_name(value);
-  // @@protoc_insertion_point(field_set:proto.ImageClass.class_name)
-}
-inline std::string* ImageClass::mutable_class_name() {
-  // @@protoc_insertion_point(field_mutable:proto.ImageClass.class_name)
-  return _internal_mutable_class_name();
-}
-inline const std::string& ImageClass::_internal_class_name() const {
-  return class_name_.GetNoArena();
-}
-inline void ImageClass::_internal_set_class_name(const std::string& value) {
-  
-  class_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void ImageClass::set_class_name(std::string&& value) {
-  
-  class_name_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:proto.ImageClass.class_name)
-}
-inline void ImageClass::set_class_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  class_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:proto.ImageClass.class_name)
-}
-inline void ImageClass::set_class_name(const char* value, size_t size) {
-  
-  class_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:proto.ImageClass.class_name)
-}
-inline std::string* ImageClass::_internal_mutable_class_name() {
-  
-  return class_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline std::string* ImageClass::release_class_name() {
-  // @@protoc_insertion_point(field_release:proto.ImageClass.class_name)
-  
-  return class_name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline void ImageClass::set_allocated_class_name(std::string* class_name) {
-  if (class_name != nullptr) {
-    
-  } else {
-    
-  }
-  class_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), class_name);
-  // @@protoc_insertion_point(field_set_allocated:proto.ImageClass.class_name)
-}
-
-// float class_confidence = 3;
-inline void ImageClass::clear_class_confidence() {
-  class_confidence_ = 0;
-}
-inline float ImageClass::_internal_class_confidence() const {
-  return class_confidence_;
-}
-inline float ImageClass::class_confidence() const {
-  // @@protoc_insertion_point(field_get:proto.ImageClass.class_confidence)
-  return _internal_class_confidence();
-}
-inline void ImageClass::_internal_set_class_confidence(float value) {
-  
-  class_confidence_ = value;
-}
-inline void ImageClass::set_class_confidence(float value) {
-  _internal_set_class_confidence(value);
-  // @@protoc_insertion_point(field_set:proto.ImageClass.class_confidence)
-}
-
-// -------------------------------------------------------------------
-
-// ClassifyResponse
-
-// string status = 1;
-inline void ClassifyResponse::clear_status() {
-  status_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline const std::string& ClassifyResponse::status() const {
-  // @@protoc_insertion_point(field_get:proto.ClassifyResponse.status)
-  return _internal_status();
-}
-inline void ClassifyResponse::set_status(const std::string& value) {
-  _internal_set_status(value);
-  // @@protoc_insertion_point(field_set:proto.ClassifyResponse.status)
-}
-inline std::string* ClassifyResponse::mutable_status() {
-  // @@protoc_insertion_point(field_mutable:proto.ClassifyResponse.status)
-  return _internal_mutable_status();
-}
-inline const std::string& ClassifyResponse::_internal_status() const {
-  return status_.GetNoArena();
-}
-inline void ClassifyResponse::_internal_set_status(const std::string& value) {
-  
-  status_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void ClassifyResponse::set_status(std::string&& value) {
-  
-  status_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:proto.ClassifyResponse.status)
-}
-inline void ClassifyResponse::set_status(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  status_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:proto.ClassifyResponse.status)
-}
-inline void ClassifyResponse::set_status(const char* value, size_t size) {
-  
-  status_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:proto.ClassifyResponse.status)
-}
-inline std::string* ClassifyResponse::_internal_mutable_status() {
-  
-  return status_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline std::string* ClassifyResponse::release_status() {
-  // @@protoc_insertion_point(field_release:proto.ClassifyResponse.status)
-  
-  return status_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline void ClassifyResponse::set_allocated_status(std::string* status) {
-  if (status != nullptr) {
-    
-  } else {
-    
-  }
-  status_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), status);
-  // @@protoc_insertion_point(field_set_allocated:proto.ClassifyResponse.status)
-}
-
-// repeated .proto.ImageClass results = 2;
-inline int ClassifyResponse::_internal_results_size() const {
-  return results_.size();
-}
-inline int ClassifyResponse::results_size() const {
-  return _internal_results_size();
-}
-inline void ClassifyResponse::clear_results() {
-  results_.Clear();
-}
-inline ::proto::ImageClass* ClassifyResponse::mutable_results(int index) {
-  // @@protoc_insertion_point(field_mutable:proto.ClassifyResponse.results)
-  return results_.Mutable(index);
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::ImageClass >*
-ClassifyResponse::mutable_results() {
-  // @@protoc_insertion_point(field_mutable_list:proto.ClassifyResponse.results)
-  return &results_;
-}
-inline const ::proto::ImageClass& ClassifyResponse::_internal_results(int index) const {
-  return results_.Get(index);
-}
-inline const ::proto::ImageClass& ClassifyResponse::results(int index) const {
-  // @@protoc_insertion_point(field_get:proto.ClassifyResponse.results)
-  return _internal_results(index);
-}
-inline ::proto::ImageClass* ClassifyResponse::_internal_add_results() {
-  return results_.Add();
-}
-inline ::proto::ImageClass* ClassifyResponse::add_results() {
-  // @@protoc_insertion_point(field_add:proto.ClassifyResponse.results)
-  return _internal_add_results();
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::ImageClass >&
-ClassifyResponse::results() const {
-  // @@protoc_insertion_point(field_list:proto.ClassifyResponse.results)
-  return results_;
-}
-
-#ifdef __GNUC__
-  #pragma GCC diagnostic pop
-#endif  // __GNUC__
-// -------------------------------------------------------------------
-
-// -------------------------------------------------------------------
-
-// -------------------------------------------------------------------
-
-// -------------------------------------------------------------------
-
-// -------------------------------------------------------------------
-
-// -------------------------------------------------------------------
-
-// -------------------------------------------------------------------
-
-// -------------------------------------------------------------------
-
-
-// @@protoc_insertion_point(namespace_scope)
-
-}  // namespace proto
-
-PROTOBUF_NAMESPACE_OPEN
-
-template <> struct is_proto_enum< ::proto::MessageType> : ::std::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::proto::MessageType>() {
-  return ::proto::MessageType_descriptor();
-}
-template <> struct is_proto_enum< ::proto::ThumbnailType> : ::std::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::proto::ThumbnailType>() {
-  return ::proto::ThumbnailType_descriptor();
-}
-
-PROTOBUF_NAMESPACE_CLOSE
-
-// @@protoc_insertion_point(global_scope)
-
-#include <google/protobuf/port_undef.inc>
-#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_ipc_2eproto
@@ -0,0 +1,470 @@
+#pragma once
+
+// Futures with continuations for ThreadPool. Unlike std::future, a Future can run a
+// continuation once its value is there (then, when_all) instead of having a thread
+// wait for it, and with C++20 it is a coroutine type: a function returning a Future
+// may co_await other Futures and ThreadPool::schedule() and co_return its result.
+//
+//   Future<Image> decoded = pool.async([&] { return decode(path); });
+//   Future<void> written = decoded.then(pool, [&](Image image) { write(resize(image)); });
+//
+// A Future has one consumer: get(), then(), on_ready() and co_await consume it.
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Task.h"
+#include "ThreadPool.h"
+
+template <class T>
+class Promise;
+
+namespace future_detail {
+
+struct Unit {};
+
+template <class T>
+using Stored = typename std::conditional<std::is_void<T>::value, Unit, T>::type;
+
+template <class R>
+struct Unwrap {
+    using type = R;
+    static constexpr bool is_future = false;
+};
+
+template <class U>
+struct Unwrap<Future<U>> {
+    using type = U;
+    static constexpr bool is_future = true;
+};
+
+// result of a continuation called with the value of a Future<T>
+template <class F, class T>
+struct ContinuationResult {
+    using type = typename std::result_of<F(T)>::type;
+};
+
+template <class F>
+struct ContinuationResult<F, void> {
+    using type = typename std::result_of<F()>::type;
+};
+
+template <class T>
+class State {
+   public:
+    template <class... V>
+    void set_value(V&&... v) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (done.load(std::memory_order_relaxed))
+                throw std::future_error(std::future_errc::promise_already_satisfied);
+            value.emplace(std::forward<V>(v)...);
+        }
+        complete();
+    }
+
+    void set_exception(std::exception_ptr e) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (done.load(std::memory_order_relaxed))
+                throw std::future_error(std::future_errc::promise_already_satisfied);
+            error = std::move(e);
+        }
+        complete();
+    }
+
+    bool ready() const { return done.load(std::memory_order_acquire); }
+
+    // Store fn to be called by whoever completes the state. false, and fn left alone,
+    // if it is complete already.
+    bool subscribe(UniqueTask& fn) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (done.load(std::memory_order_relaxed))
+            return false;
+        callback = std::move(fn);
+        return true;
+    }
+
+    // A worker of a pool runs its queued subtasks meanwhile, like ThreadPool::wait.
+    void wait() {
+        if (ready())
+            return;
+        ThreadPool* pool = ThreadPool::current();
+        std::unique_lock<std::mutex> lock(mutex);
+        while (!done.load(std::memory_order_relaxed)) {
+            if (pool) {
+                lock.unlock();
+                bool ran = pool->run_pending_task();
+                lock.lock();
+                if (ran)
+                    continue;
+                cv.wait_for(lock, std::chrono::microseconds(100));
+            } else {
+                cv.wait(lock);
+            }
+        }
+    }
+
+    // ready only
+    bool failed() const { return error != nullptr; }
+    std::exception_ptr exception() const { return error; }
+
+    // ready only, once
+    T take() {
+        if (error)
+            std::rethrow_exception(error);
+        if constexpr (!std::is_void<T>::value)
+            return std::move(*value);
+    }
+
+   private:
+    void complete() {
+        UniqueTask fn;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            done.store(true, std::memory_order_release);
+            fn = std::move(callback);
+            cv.notify_all();
+        }
+        if (fn)
+            fn();
+    }
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::atomic<bool> done{false};
+    std::optional<Stored<T>> value;
+    std::exception_ptr error;
+    UniqueTask callback;
+};
+
+template <class T>
+void forward_result(Promise<T>& promise, Future<T>&& ready);
+
+// Complete promise with fn(args...), unwrapping a Future returned by fn.
+template <class R, class F, class... Args>
+void fulfill(Promise<typename Unwrap<R>::type>& promise, F& fn, Args&&... args) {
+    try {
+        if constexpr (Unwrap<R>::is_future) {
+            fn(std::forward<Args>(args)...)
+                .on_ready([promise = std::move(promise)](auto ready) mutable {
+                    forward_result(promise, std::move(ready));
+                });
+        } else if constexpr (std::is_void<R>::value) {
+            fn(std::forward<Args>(args)...);
+            promise.set_value();
+        } else {
+            promise.set_value(fn(std::forward<Args>(args)...));
+        }
+    } catch (...) {
+        promise.set_exception(std::current_exception());
+    }
+}
+
+}  // namespace future_detail
+
+template <class T>
+class Future final {
+   public:
+    using value_type = T;
+
+    Future() = default;
+
+    bool valid() const { return state != nullptr; }
+    bool ready() const { return state->ready(); }
+
+    // Block until ready; a worker of a pool runs its queued tasks meanwhile.
+    void wait() const { state->wait(); }
+
+    // Wait and return the value, or rethrow what the producer threw.
+    T get() {
+        wait();
+        auto ready_state = std::move(state);
+        return ready_state->take();
+    }
+
+    // Run fn(value) (fn() for Future<void>) on pool once this is ready. If fn returns
+    // a Future, the result completes with that one. If this failed, fn is skipped and
+    // the result fails with the same exception.
+    template <class F>
+    auto then(ThreadPool& pool, F&& fn)
+        -> Future<typename future_detail::Unwrap<
+            typename future_detail::ContinuationResult<F, T>::type>::type> {
+        using R = typename future_detail::ContinuationResult<F, T>::type;
+        Promise<typename future_detail::Unwrap<R>::type> promise;
+        auto result = promise.get_future();
+        on_ready([&pool, fn = std::forward<F>(fn),
+                  promise = std::move(promise)](Future<T> ready) mutable {
+            auto run = [fn = std::move(fn), promise = std::move(promise),
+                        ready = std::move(ready)]() mutable {
+                if (ready.state->failed()) {
+                    promise.set_exception(ready.state->exception());
+                } else if constexpr (std::is_void<T>::value) {
+                    future_detail::fulfill<R>(promise, fn);
+                } else {
+                    future_detail::fulfill<R>(promise, fn, ready.get());
+                }
+            };
+            try {
+                pool.post(std::move(run));
+            } catch (const std::runtime_error&) {
+                // stopped pool, the dropped promise fails the result as broken
+            }
+        });
+        return result;
+    }
+
+    // Call fn(ready_future) once this is ready, on the thread that completes it or
+    // right here if it already is. fn should be short; then() and co_await are
+    // built on it.
+    template <class F>
+    void on_ready(F&& fn) {
+        auto ready_state = std::move(state);
+        UniqueTask callback([ready_state, fn = std::forward<F>(fn)]() mutable {
+            fn(Future<T>(ready_state));
+        });
+        if (!ready_state->subscribe(callback))
+            callback();
+    }
+
+#ifdef THREAD_POOL_COROUTINES
+    struct Awaiter;
+    Awaiter operator co_await() && { return Awaiter{std::move(*this)}; }
+    Awaiter operator co_await() & { return Awaiter{std::move(*this)}; }
+    struct promise_type;
+#endif
+
+   private:
+    friend class Promise<T>;
+    template <class U>
+    friend class Future;
+    template <class U>
+    friend void future_detail::forward_result(Promise<U>& promise, Future<U>&& ready);
+
+    explicit Future(std::shared_ptr<future_detail::State<T>> state) : state(std::move(state)) {}
+
+    std::shared_ptr<future_detail::State<T>> state;
+};
+
+template <class T>
+class Promise final {
+   public:
+    Promise() : state(std::make_shared<future_detail::State<T>>()) {}
+    Promise(Promise&&) noexcept = default;
+    Promise& operator=(Promise&& other) noexcept {
+        abandon();
+        state = std::move(other.state);
+        return *this;
+    }
+    // a promise dropped without a result fails its future with broken_promise
+    ~Promise() { abandon(); }
+
+    Future<T> get_future() { return Future<T>(state); }
+
+    template <class... V>
+    void set_value(V&&... v) {
+        state->set_value(std::forward<V>(v)...);
+    }
+    void set_exception(std::exception_ptr e) { state->set_exception(std::move(e)); }
+
+   private:
+    void abandon() {
+        if (state && !state->ready())
+            state->set_exception(
+                std::make_exception_ptr(std::future_error(std::future_errc::broken_promise)));
+    }
+
+    std::shared_ptr<future_detail::State<T>> state;
+};
+
+template <class T>
+void future_detail::forward_result(Promise<T>& promise, Future<T>&& ready) {
+    if (ready.state->failed()) {
+        promise.set_exception(ready.state->exception());
+    } else if constexpr (std::is_void<T>::value) {
+        promise.set_value();
+    } else {
+        promise.set_value(ready.get());
+    }
+}
+
+template <class T>
+Future<typename std::decay<T>::type> make_ready_future(T&& value) {
+    Promise<typename std::decay<T>::type> promise;
+    promise.set_value(std::forward<T>(value));
+    return promise.get_future();
+}
+
+inline Future<void> make_ready_future() {
+    Promise<void> promise;
+    promise.set_value();
+    return promise.get_future();
+}
+
+template <class T>
+Future<T> make_exceptional_future(std::exception_ptr e) {
+    Promise<T> promise;
+    promise.set_exception(std::move(e));
+    return promise.get_future();
+}
+
+// Ready once all of futures are: with their values in order, or with the first
+// exception once all are done. Nothing waits, the last one to finish completes it.
+template <class T>
+auto when_all(std::vector<Future<T>> futures)
+    -> Future<typename std::conditional<std::is_void<T>::value, void, std::vector<T>>::type> {
+    using Result = typename std::conditional<std::is_void<T>::value, void, std::vector<T>>::type;
+    struct Join {
+        std::mutex mutex;
+        std::vector<std::optional<future_detail::Stored<T>>> values;
+        std::exception_ptr error;
+        std::atomic<size_t> remaining;
+        Promise<Result> promise;
+    };
+
+    auto join = std::make_shared<Join>();
+    auto result = join->promise.get_future();
+    if (futures.empty()) {
+        if constexpr (std::is_void<T>::value) {
+            join->promise.set_value();
+        } else {
+            join->promise.set_value(std::vector<T>());
+        }
+        return result;
+    }
+
+    join->values.resize(futures.size());
+    join->remaining.store(futures.size(), std::memory_order_relaxed);
+    for (size_t i = 0; i < futures.size(); i++) {
+        futures[i].on_ready([join, i](Future<T> ready) {
+            try {
+                if constexpr (std::is_void<T>::value) {
+                    ready.get();
+                } else {
+                    T value = ready.get();
+                    std::lock_guard<std::mutex> lock(join->mutex);
+                    join->values[i].emplace(std::move(value));
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(join->mutex);
+                if (!join->error)
+                    join->error = std::current_exception();
+            }
+            if (join->remaining.fetch_sub(1, std::memory_order_acq_rel) != 1)
+                return;
+
+            if (join->error) {
+                join->promise.set_exception(join->error);
+            } else if constexpr (std::is_void<T>::value) {
+                join->promise.set_value();
+            } else {
+                std::vector<T> values;
+                values.reserve(join->values.size());
+                for (auto& value : join->values) values.push_back(std::move(*value));
+                join->promise.set_value(std::move(values));
+            }
+        });
+    }
+    return result;
+}
+
+template <class F>
+auto ThreadPool::async(F&& f)
+    -> Future<typename future_detail::Unwrap<typename std::result_of<F()>::type>::type> {
+    using R = typename std::result_of<F()>::type;
+    Promise<typename future_detail::Unwrap<R>::type> promise;
+    auto result = promise.get_future();
+    // a subtask when added by a worker, unlike a posted task
+    enqueue(TaskT(0u, UniqueTask([f = std::forward<F>(f), promise = std::move(promise)]() mutable {
+        future_detail::fulfill<R>(promise, f);
+    })));
+    return result;
+}
+
+#ifdef THREAD_POOL_COROUTINES
+
+namespace future_detail {
+
+// Continue the coroutine h on pool, or here when there is none or it is stopping.
+inline void resume_on(ThreadPool* pool, std::coroutine_handle<> h) {
+    if (pool) {
+        try {
+            pool->post([h] { h.resume(); });
+            return;
+        } catch (const std::runtime_error&) {
+        }
+    }
+    h.resume();
+}
+
+template <class T>
+struct PromiseBase {
+    Promise<T> promise;
+
+    Future<T> get_return_object() { return promise.get_future(); }
+    // runs eagerly up to its first suspension, like any function call
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void unhandled_exception() { promise.set_exception(std::current_exception()); }
+};
+
+template <class T>
+struct CoroutinePromise : PromiseBase<T> {
+    template <class V>
+    void return_value(V&& value) {
+        this->promise.set_value(std::forward<V>(value));
+    }
+};
+
+template <>
+struct CoroutinePromise<void> : PromiseBase<void> {
+    void return_void() { this->promise.set_value(); }
+};
+
+struct ScheduleAwaiter {
+    ThreadPool& pool;
+
+    bool await_ready() const { return pool.is_owner(); }
+    void await_suspend(std::coroutine_handle<> h) { pool.post([h] { h.resume(); }); }
+    void await_resume() const {}
+};
+
+}  // namespace future_detail
+
+template <class T>
+struct Future<T>::promise_type : future_detail::CoroutinePromise<T> {};
+
+// A coroutine awaiting a Future continues on the pool it was running on when it
+// suspended, or on the thread completing the Future when it was not on a pool.
+template <class T>
+struct Future<T>::Awaiter {
+    Future<T> future;
+
+    bool await_ready() const { return future.ready(); }
+
+    bool await_suspend(std::coroutine_handle<> h) {
+        // the coroutine, and this awaiter with it, may be resumed and gone before
+        // subscribe returns
+        auto state = future.state;
+        UniqueTask resume([h, pool = ThreadPool::current()] {
+            future_detail::resume_on(pool, h);
+        });
+        return state->subscribe(resume);
+    }
+
+    T await_resume() { return future.get(); }
+};
+
+inline future_detail::ScheduleAwaiter ThreadPool::schedule() {
+    return future_detail::ScheduleAwaiter{*this};
+}
+
+#endif  // THREAD_POOL_COROUTINES
@@ -0,0 +1,68 @@
+#include "Histogram.h"
+
+#include <algorithm>
+
+namespace {
+
+int highest_bit(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return 63 - __builtin_clzll(value);
+#else
+    int bit = 0;
+    while (value >>= 1) bit++;
+    return bit;
+#endif
+}
+
+}  // namespace
+
+int Histogram::bucket_index(uint64_t value) {
+    if (value < kSubBucketCount)
+        return static_cast<int>(value);
+
+    int shift = highest_bit(value) - kSubBucketBits;
+    int sub_bucket = static_cast<int>(value >> shift) - kSubBucketCount;
+    return (shift + 1) * kSubBucketCount + sub_bucket;
+}
+
+uint64_t Histogram::bucket_midpoint(int index) {
+    if (index < kSubBucketCount)
+        return index;
+
+    int shift = index / kSubBucketCount - 1;
+    uint64_t lower = (kSubBucketCount + uint64_t(index % kSubBucketCount)) << shift;
+    return lower + ((uint64_t(1) << shift) >> 1);
+}
+
+void Histogram::record(uint64_t value) {
+    buckets[bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum.fetch_add(value, std::memory_order_relaxed);
+
+    uint64_t current = max_.load(std::memory_order_relaxed);
+    while (value > current &&
+           !max_.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+double Histogram::mean() const {
+    uint64_t n = count();
+    return n == 0 ? 0 : static_cast<double>(sum.load(std::memory_order_relaxed)) / n;
+}
+
+uint64_t Histogram::value_at_quantile(double q) const {
+    // buckets keep changing while we walk them, the result is approximate anyway
+    uint64_t total = 0;
+    for (const auto& bucket : buckets) total += bucket.load(std::memory_order_relaxed);
+    if (total == 0)
+        return 0;
+
+    uint64_t rank = std::min(static_cast<uint64_t>(q * total), total - 1);
+    uint64_t seen = 0;
+    for (int i = 0; i < kBucketCount; i++) {
+        seen += buckets[i].load(std::memory_order_relaxed);
+        if (seen > rank)
+            return std::min(bucket_midpoint(i), max());
+    }
+    return max();
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+// Log-linear histogram in the spirit of HdrHistogram, used by the pool
+// instrumentation and by easyipc's server metrics: every power of two is split in 16
+// sub-buckets, so recorded values are kept with about 6% relative precision over the
+// whole 64-bit range. Recording is a few relaxed atomics, so it can stay on.
+
+#include <atomic>
+#include <cstdint>
+
+class Histogram final {
+   public:
+    static constexpr int kSubBucketBits = 4;
+    static constexpr int kSubBucketCount = 1 << kSubBucketBits;
+    static constexpr int kBucketCount = (64 - kSubBucketBits + 1) * kSubBucketCount;
+
+    Histogram() = default;
+    Histogram(const Histogram&) = delete;
+    void operator=(const Histogram&) = delete;
+
+    void record(uint64_t value);
+
+    uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+    uint64_t max() const { return max_.load(std::memory_order_relaxed); }
+    double mean() const;
+
+    // Value at quantile q in [0, 1], reported as the middle of its bucket; 0 while
+    // nothing was recorded.
+    uint64_t value_at_quantile(double q) const;
+
+   private:
+    static int bucket_index(uint64_t value);
+    static uint64_t bucket_midpoint(int index);
+
+    std::atomic<uint64_t> buckets[kBucketCount] = {};
+    std::atomic<uint64_t> count_{0};
+    std::atomic<uint64_t> sum{0};
+    std::atomic<uint64_t> max_{0};
+};
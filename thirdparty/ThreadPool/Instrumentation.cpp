@@ -0,0 +1,247 @@
+#include "Instrumentation.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace {
+
+void append_json_string(std::string& out, const std::string& text) {
+    out += '"';
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            out += escaped;
+        } else {
+            out += c;
+        }
+    }
+    out += '"';
+}
+
+void append_time_stats(std::string& out, const char* name, const TaskTimeStats& stats) {
+    char buffer[256];
+    std::snprintf(buffer, sizeof(buffer),
+                  "\"%s\":{\"count\":%llu,\"mean\":%.1f,\"p50\":%.1f,\"p90\":%.1f,"
+                  "\"p99\":%.1f,\"max\":%.1f}",
+                  name, static_cast<unsigned long long>(stats.count), stats.mean_us,
+                  stats.p50_us, stats.p90_us, stats.p99_us, stats.max_us);
+    out += buffer;
+}
+
+TaskTimeStats time_stats(const Histogram& ns) {
+    TaskTimeStats stats;
+    stats.count = ns.count();
+    if (stats.count == 0)
+        return stats;
+    stats.mean_us = ns.mean() / 1000.0;
+    stats.p50_us = ns.value_at_quantile(0.5) / 1000.0;
+    stats.p90_us = ns.value_at_quantile(0.9) / 1000.0;
+    stats.p99_us = ns.value_at_quantile(0.99) / 1000.0;
+    stats.max_us = ns.max() / 1000.0;
+    return stats;
+}
+
+}  // namespace
+
+std::string to_json(const PoolStats& stats) {
+    char buffer[256];
+    std::string out = "{\"pool\":";
+    append_json_string(out, stats.pool);
+    std::snprintf(buffer, sizeof(buffer),
+                  ",\"elapsed_seconds\":%.3f,\"queue_depth\":%zu,\"max_queue_depth\":%zu,"
+                  "\"dropped_events\":%llu,\"workers\":[",
+                  stats.elapsed_seconds, stats.queue_depth, stats.max_queue_depth,
+                  static_cast<unsigned long long>(stats.dropped_events));
+    out += buffer;
+    for (size_t i = 0; i < stats.workers.size(); i++) {
+        const PoolStats::Worker& worker = stats.workers[i];
+        std::snprintf(buffer, sizeof(buffer),
+                      "%s{\"index\":%zu,\"tasks\":%llu,\"busy_seconds\":%.3f,"
+                      "\"utilization\":%.3f}",
+                      i ? "," : "", worker.index, static_cast<unsigned long long>(worker.tasks),
+                      worker.busy_seconds, worker.utilization);
+        out += buffer;
+    }
+    out += "],\"task_classes\":[";
+    for (size_t i = 0; i < stats.task_classes.size(); i++) {
+        const PoolStats::TaskClass& cls = stats.task_classes[i];
+        out += i ? ",{\"id\":" : "{\"id\":";
+        out += std::to_string(cls.id) + ",\"label\":";
+        append_json_string(out, cls.label);
+        out += ",";
+        append_time_stats(out, "wait_us", cls.wait);
+        out += ",";
+        append_time_stats(out, "run_us", cls.run);
+        out += "}";
+    }
+    out += "]}";
+    return out;
+}
+
+PoolProfiler::PoolProfiler(const std::string& pool, size_t workers, const Options& options)
+    : pool(pool),
+      options(options),
+      epoch_ns(now_ns()),
+      classes(new TaskClassSlot[TrackedIds + 1]),
+      workers(new WorkerSlot[workers]),
+      worker_count(workers) {
+    for (size_t i = 0; i < workers; i++) this->workers[i].events.reserve(options.max_trace_events);
+    samples.reserve(options.max_depth_samples);
+}
+
+void PoolProfiler::on_enqueue() {
+    int64_t now = depth.fetch_add(1, std::memory_order_relaxed) + 1;
+    int64_t current = max_depth.load(std::memory_order_relaxed);
+    while (now > current &&
+           !max_depth.compare_exchange_weak(current, now, std::memory_order_relaxed)) {
+    }
+    sample_depth(now_ns(), now);
+}
+
+void PoolProfiler::on_start(int64_t start_ns) {
+    sample_depth(start_ns, depth.fetch_sub(1, std::memory_order_relaxed) - 1);
+}
+
+void PoolProfiler::sample_depth(int64_t now, int64_t depth) {
+    if (options.max_depth_samples == 0)
+        return;
+    int64_t last = last_sample_ns.load(std::memory_order_relaxed);
+    int64_t interval = std::chrono::nanoseconds(options.depth_sample_interval).count();
+    if (now - last < interval ||
+        !last_sample_ns.compare_exchange_strong(last, now, std::memory_order_relaxed))
+        return;
+
+    // the counter may dip below zero while a task is taken before on_enqueue counted it
+    PoolStats::DepthSample sample{(now - epoch_ns) / 1e9,
+                                  static_cast<size_t>(std::max<int64_t>(depth, 0))};
+    std::lock_guard<std::mutex> lock(samples_mutex);
+    if (samples.size() < options.max_depth_samples) {
+        samples.push_back(sample);
+    } else {
+        samples[next_sample] = sample;
+        dropped_samples++;
+    }
+    next_sample = (next_sample + 1) % options.max_depth_samples;
+}
+
+void PoolProfiler::on_finish(size_t worker, uint16_t id, int64_t enqueued_ns, int64_t start_ns,
+                             int64_t end_ns, int64_t busy_ns) {
+    TaskClassSlot& cls = classes[std::min<int>(id, TrackedIds)];
+    cls.wait.record(static_cast<uint64_t>(std::max<int64_t>(start_ns - enqueued_ns, 0)));
+    cls.run.record(static_cast<uint64_t>(std::max<int64_t>(end_ns - start_ns, 0)));
+
+    WorkerSlot& slot = workers[worker];
+    slot.tasks.fetch_add(1, std::memory_order_relaxed);
+    slot.busy_ns.fetch_add(static_cast<uint64_t>(std::max<int64_t>(busy_ns, 0)),
+                           std::memory_order_relaxed);
+
+    if (options.max_trace_events == 0)
+        return;
+    TraceEvent event{id, enqueued_ns, start_ns, end_ns};
+    std::lock_guard<std::mutex> lock(slot.mutex);
+    if (slot.events.size() < options.max_trace_events) {
+        slot.events.push_back(event);
+    } else {
+        slot.events[slot.next_event] = event;
+        slot.dropped++;
+    }
+    slot.next_event = (slot.next_event + 1) % options.max_trace_events;
+}
+
+std::string PoolProfiler::label_of(int id, const Labels& labels) {
+    if (id < 0)
+        return "other";
+    auto it = labels.find(static_cast<uint16_t>(id));
+    return it != labels.end() ? it->second : "task " + std::to_string(id);
+}
+
+std::vector<PoolStats::DepthSample> PoolProfiler::depth_samples(uint64_t* dropped) const {
+    std::lock_guard<std::mutex> lock(samples_mutex);
+    // oldest first
+    std::vector<PoolStats::DepthSample> ordered;
+    size_t start = samples.size() < options.max_depth_samples ? 0 : next_sample;
+    for (size_t i = 0; i < samples.size(); i++)
+        ordered.push_back(samples[(start + i) % samples.size()]);
+    if (dropped)
+        *dropped += dropped_samples;
+    return ordered;
+}
+
+PoolStats PoolProfiler::stats(const Labels& labels) const {
+    PoolStats stats;
+    stats.pool = pool;
+    stats.elapsed_seconds = (now_ns() - epoch_ns) / 1e9;
+    stats.queue_depth = static_cast<size_t>(std::max<int64_t>(depth.load(), 0));
+    stats.max_queue_depth = static_cast<size_t>(max_depth.load());
+
+    stats.queue_depth_samples = depth_samples(&stats.dropped_events);
+
+    for (int i = 0; i <= TrackedIds; i++) {
+        TaskTimeStats wait = time_stats(classes[i].wait);
+        if (wait.count == 0)
+            continue;
+        int id = i == TrackedIds ? -1 : i;
+        stats.task_classes.push_back({id, label_of(id, labels), wait, time_stats(classes[i].run)});
+    }
+
+    for (size_t i = 0; i < worker_count; i++) {
+        const WorkerSlot& slot = workers[i];
+        double busy = slot.busy_ns.load(std::memory_order_relaxed) / 1e9;
+        stats.workers.push_back({i, slot.tasks.load(std::memory_order_relaxed), busy,
+                                 stats.elapsed_seconds > 0 ? busy / stats.elapsed_seconds : 0});
+        std::lock_guard<std::mutex> lock(slot.mutex);
+        stats.dropped_events += slot.dropped;
+    }
+    return stats;
+}
+
+void PoolProfiler::write_chrome_trace(std::ostream& out, const Labels& labels) const {
+    auto us = [this](int64_t ns) { return (ns - epoch_ns) / 1000.0; };
+    char buffer[256];
+    std::string line;
+
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    line = "{\"ph\":\"M\",\"pid\":1,\"name\":\"process_name\",\"args\":{\"name\":";
+    append_json_string(line, pool);
+    out << line << "}}";
+
+    for (size_t i = 0; i < worker_count; i++) {
+        line = ",\n{\"ph\":\"M\",\"pid\":1,\"tid\":" + std::to_string(i) +
+               ",\"name\":\"thread_name\",\"args\":{\"name\":";
+        append_json_string(line, pool + "[" + std::to_string(i) + "]");
+        out << line << "}}";
+
+        std::vector<TraceEvent> events;
+        {
+            std::lock_guard<std::mutex> lock(workers[i].mutex);
+            events = workers[i].events;
+        }
+        // a worker that helped while waiting recorded the inner tasks first, the
+        // viewer wants every tid in start order to nest them
+        std::sort(events.begin(), events.end(),
+                  [](const TraceEvent& a, const TraceEvent& b) { return a.start_ns < b.start_ns; });
+        for (const TraceEvent& event : events) {
+            line = ",\n{\"ph\":\"X\",\"pid\":1,\"tid\":" + std::to_string(i) + ",\"name\":";
+            append_json_string(line, label_of(event.id, labels));
+            std::snprintf(buffer, sizeof(buffer),
+                          ",\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"id\":%u,\"wait_us\":%.3f}}",
+                          us(event.start_ns), (event.end_ns - event.start_ns) / 1000.0,
+                          static_cast<unsigned>(event.id),
+                          (event.start_ns - event.enqueued_ns) / 1000.0);
+            out << line << buffer;
+        }
+    }
+
+    for (const auto& sample : depth_samples(nullptr)) {
+        std::snprintf(buffer, sizeof(buffer),
+                      ",\n{\"ph\":\"C\",\"pid\":1,\"name\":\"queue depth\",\"ts\":%.3f,"
+                      "\"args\":{\"depth\":%zu}}",
+                      sample.time_seconds * 1e6, sample.depth);
+        out << buffer;
+    }
+    out << "\n]}\n";
+}
@@ -0,0 +1,153 @@
+#pragma once
+
+// Optional instrumentation of ThreadPool: queue depth over time, enqueue-to-start
+// latency and run time per task id, busy time per worker, and a Chrome trace
+// (chrome://tracing or ui.perfetto.dev) of the tasks that ran. Everything is
+// recorded by the workers themselves, the per-task cost is two clock reads and a
+// handful of uncontended atomics.
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "Histogram.h"
+
+// Distribution of durations, in microseconds.
+struct TaskTimeStats {
+    uint64_t count = 0;
+    double mean_us = 0;
+    double p50_us = 0;
+    double p90_us = 0;
+    double p99_us = 0;
+    double max_us = 0;
+};
+
+struct PoolStats {
+    // tasks added with one id (add_taski), add_task and post use id 0
+    struct TaskClass {
+        // -1 gathers the ids from PoolProfiler::TrackedIds up
+        int id;
+        std::string label;
+        // from being added to the pool to starting on a worker
+        TaskTimeStats wait;
+        // start to end, including tasks the worker ran while it waited inside
+        TaskTimeStats run;
+    };
+    struct Worker {
+        size_t index;
+        uint64_t tasks;
+        // time spent running tasks, nested tasks counted once
+        double busy_seconds;
+        // busy_seconds over elapsed_seconds
+        double utilization;
+    };
+    struct DepthSample {
+        double time_seconds;
+        size_t depth;
+    };
+
+    std::string pool;
+    // since instrumentation was first enabled
+    double elapsed_seconds = 0;
+    // tasks added and not started yet
+    size_t queue_depth = 0;
+    size_t max_queue_depth = 0;
+    std::vector<DepthSample> queue_depth_samples;
+    std::vector<TaskClass> task_classes;
+    std::vector<Worker> workers;
+    // trace events and depth samples overwritten because their buffers were full
+    uint64_t dropped_events = 0;
+};
+
+// One JSON object holding everything in stats; durations in microseconds.
+std::string to_json(const PoolStats& stats);
+
+class PoolProfiler final {
+   public:
+    struct Options {
+        // trace events kept per worker, the oldest are overwritten; 0 keeps none
+        size_t max_trace_events = 1 << 16;
+        // queue depth is sampled at most this often
+        std::chrono::microseconds depth_sample_interval{1000};
+        size_t max_depth_samples = 1 << 16;
+    };
+
+    // ids 0 .. TrackedIds - 1 get their own statistics
+    static constexpr int TrackedIds = 64;
+
+    PoolProfiler(const std::string& pool, size_t workers, const Options& options);
+    PoolProfiler(const PoolProfiler&) = delete;
+    void operator=(const PoolProfiler&) = delete;
+
+    static int64_t now_ns() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    // a task was added to the queues
+    void on_enqueue();
+    // a task was taken off the queues
+    void on_start(int64_t start_ns);
+    // worker only. busy_ns excludes the tasks the worker ran nested in this one.
+    void on_finish(size_t worker, uint16_t id, int64_t enqueued_ns, int64_t start_ns,
+                   int64_t end_ns, int64_t busy_ns);
+
+    // labels name task ids, the others are reported as "task <id>"
+    using Labels = std::map<uint16_t, std::string>;
+    PoolStats stats(const Labels& labels) const;
+    void write_chrome_trace(std::ostream& out, const Labels& labels) const;
+
+   private:
+    struct TraceEvent {
+        uint16_t id;
+        int64_t enqueued_ns;
+        int64_t start_ns;
+        int64_t end_ns;
+    };
+
+    struct alignas(64) WorkerSlot {
+        std::atomic<uint64_t> tasks{0};
+        std::atomic<uint64_t> busy_ns{0};
+        // taken by its worker for every event, by readers rarely
+        mutable std::mutex mutex;
+        std::vector<TraceEvent> events;
+        size_t next_event = 0;
+        uint64_t dropped = 0;
+    };
+
+    struct TaskClassSlot {
+        // nanoseconds
+        Histogram wait;
+        Histogram run;
+    };
+
+    void sample_depth(int64_t now, int64_t depth);
+    // adds the overwritten ones to dropped when given
+    std::vector<PoolStats::DepthSample> depth_samples(uint64_t* dropped) const;
+    static std::string label_of(int id, const Labels& labels);
+
+    const std::string pool;
+    const Options options;
+    const int64_t epoch_ns;
+
+    std::atomic<int64_t> depth{0};
+    std::atomic<int64_t> max_depth{0};
+    std::atomic<int64_t> last_sample_ns{0};
+
+    std::unique_ptr<TaskClassSlot[]> classes;
+    std::unique_ptr<WorkerSlot[]> workers;
+    const size_t worker_count;
+
+    mutable std::mutex samples_mutex;
+    std::vector<PoolStats::DepthSample> samples;
+    size_t next_sample = 0;
+    uint64_t dropped_samples = 0;
+};
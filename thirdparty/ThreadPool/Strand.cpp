@@ -0,0 +1,104 @@
+#include "Strand.h"
+
+#include <stdexcept>
+#include <thread>
+
+#include "ThreadPool.h"
+
+thread_local const Strand::State* Strand::running = nullptr;
+
+Strand::Strand(ThreadPool& pool) : state(std::make_shared<State>(pool)) {}
+
+bool Strand::running_in_this_thread() const { return running == state.get(); }
+
+Strand::State::State(ThreadPool& pool) : pool(pool), head(&stub), tail(&stub) {}
+
+Strand::State::~State() {
+    // only reached with nothing pending, the drain task holds a reference
+    while (Node* node = pop()) delete_node(node);
+}
+
+Strand::State::Node* Strand::State::make_node(UniqueTask&& func) {
+    Node* node = new (task_memory::allocate(sizeof(Node))) Node;
+    node->func = std::move(func);
+    return node;
+}
+
+void Strand::State::delete_node(Node* node) {
+    node->~Node();
+    task_memory::deallocate(node, sizeof(Node));
+}
+
+void Strand::State::push(UniqueTask&& func) {
+    Node* node = make_node(std::move(func));
+    Node* prev = head.exchange(node, std::memory_order_acq_rel);
+    prev->next.store(node, std::memory_order_release);
+
+    if (pending.fetch_add(1, std::memory_order_acq_rel) == 0)
+        schedule();
+}
+
+Strand::State::Node* Strand::State::pop() {
+    Node* first = tail;
+    Node* next = first->next.load(std::memory_order_acquire);
+    if (first == &stub) {
+        if (!next)
+            return nullptr;
+        tail = next;
+        first = next;
+        next = next->next.load(std::memory_order_acquire);
+    }
+    if (next) {
+        tail = next;
+        return first;
+    }
+    if (first != head.load(std::memory_order_acquire))
+        return nullptr;
+
+    // first is the last node, put the stub behind it so that it can be taken
+    stub.next.store(nullptr, std::memory_order_relaxed);
+    Node* prev = head.exchange(&stub, std::memory_order_acq_rel);
+    prev->next.store(&stub, std::memory_order_release);
+    next = first->next.load(std::memory_order_acquire);
+    if (next) {
+        tail = next;
+        return first;
+    }
+    return nullptr;
+}
+
+bool Strand::State::run_batch() {
+    const State* outer = running;
+    running = this;
+    for (size_t done = 0; done < kBatch; done++) {
+        Node* node;
+        // pending says a node is on its way, its producer is between the exchange
+        // and the link in push
+        while (!(node = pop())) std::this_thread::yield();
+        node->func();
+        delete_node(node);
+
+        if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            running = outer;
+            return false;
+        }
+    }
+    running = outer;
+    return true;
+}
+
+void Strand::State::schedule() {
+    try {
+        pool.post([self = shared_from_this()] { self->drain(); });
+        return;
+    } catch (const std::runtime_error&) {
+    }
+    // the pool is stopping and takes no tasks from outside, run them here
+    while (run_batch()) {
+    }
+}
+
+void Strand::State::drain() {
+    if (run_batch())
+        schedule();
+}
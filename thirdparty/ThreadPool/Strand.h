@@ -0,0 +1,99 @@
+#pragma once
+
+// Serial executor on top of a ThreadPool: tasks posted to one Strand run one at a
+// time in the order they were posted, on whichever worker is free. Strands cost a
+// queue each and no thread, so ordering per key (one import job, one index shard)
+// scales with the number of keys rather than needing a mutex or a thread per key.
+
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "Task.h"
+
+class ThreadPool;
+
+class Strand final {
+   public:
+    explicit Strand(ThreadPool& pool);
+    // tasks still queued keep running after the Strand is gone
+    ~Strand() = default;
+    Strand(const Strand&) = delete;
+    void operator=(const Strand&) = delete;
+
+    // Run f after every task posted before it and never concurrently with them. f must
+    // not throw, like ThreadPool::post.
+    template <class F>
+    void post(F&& f) {
+        state->push(UniqueTask(std::forward<F>(f)));
+    }
+
+    // post with a future for the result or exception of f
+    template <class F>
+    auto add_task(F&& f) -> std::future<typename std::result_of<F()>::type> {
+        using R = typename std::result_of<F()>::type;
+        std::promise<R> promise(std::allocator_arg, task_memory::PoolAllocator<R>());
+        auto res = promise.get_future();
+        post([promise = std::move(promise), f = std::forward<F>(f)]() mutable {
+            try {
+                if constexpr (std::is_void<R>::value) {
+                    f();
+                    promise.set_value();
+                } else {
+                    promise.set_value(f());
+                }
+            } catch (...) {
+                promise.set_exception(std::current_exception());
+            }
+        });
+        return res;
+    }
+
+    // true inside a task of this strand
+    bool running_in_this_thread() const;
+
+    ThreadPool& pool() const { return state->pool; }
+
+   private:
+    // Tasks go through an intrusive multi-producer single-consumer queue (Vyukov's);
+    // pending counts the tasks posted and not run yet, whoever raises it from zero
+    // schedules the drain on the pool.
+    struct State : std::enable_shared_from_this<State> {
+        struct Node {
+            std::atomic<Node*> next{nullptr};
+            UniqueTask func;
+        };
+
+        explicit State(ThreadPool& pool);
+        ~State();
+
+        void push(UniqueTask&& func);
+        // post a drain to the pool, or drain here if the pool is stopping
+        void schedule();
+        // the pool task: a batch, then the rest in a fresh pool task so that a busy
+        // strand does not hold a worker forever
+        void drain();
+        // runs up to kBatch tasks, true if more are pending
+        bool run_batch();
+        // consumer only; nullptr while a producer is half way through push
+        Node* pop();
+
+        static Node* make_node(UniqueTask&& func);
+        static void delete_node(Node* node);
+
+        static constexpr size_t kBatch = 64;
+
+        ThreadPool& pool;
+        std::atomic<size_t> pending{0};
+        alignas(64) std::atomic<Node*> head;
+        alignas(64) Node* tail;
+        Node stub;
+    };
+
+    thread_local static const State* running;
+
+    std::shared_ptr<State> state;
+};
@@ -0,0 +1,123 @@
+#include "Task.h"
+
+#include <mutex>
+#include <vector>
+
+namespace task_memory {
+
+namespace {
+
+// size classes of 64, 128, 256 and 512 bytes
+constexpr std::size_t MinClassSize = 64;
+constexpr std::size_t ClassCount = 4;
+// blocks a thread keeps per class before it hands a batch to the depot
+constexpr std::size_t CacheLimit = 256;
+constexpr std::size_t BatchSize = 64;
+
+static_assert(MinClassSize << (ClassCount - 1) == MaxPooledSize, "size classes");
+
+struct FreeBlock {
+    FreeBlock* next;
+};
+
+std::size_t size_class(std::size_t size) {
+    std::size_t cls = 0;
+    while ((MinClassSize << cls) < size) cls++;
+    return cls;
+}
+
+// Batches of BatchSize blocks moving between threads, e.g. from the workers that
+// run tasks back to the thread that submits them.
+class Depot {
+   public:
+    void put(std::size_t cls, FreeBlock* batch) {
+        std::lock_guard<std::mutex> lock(mutex);
+        batches[cls].push_back(batch);
+    }
+
+    FreeBlock* take(std::size_t cls) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (batches[cls].empty())
+            return nullptr;
+        FreeBlock* batch = batches[cls].back();
+        batches[cls].pop_back();
+        return batch;
+    }
+
+   private:
+    std::mutex mutex;
+    std::vector<FreeBlock*> batches[ClassCount];
+};
+
+Depot& depot() {
+    // never destroyed: workers of static pools still free blocks while statics go away
+    static Depot* instance = new Depot;
+    return *instance;
+}
+
+struct ThreadCache {
+    FreeBlock* heads[ClassCount] = {};
+    std::size_t counts[ClassCount] = {};
+
+    ~ThreadCache();
+};
+
+thread_local ThreadCache cache;
+// trivially destructible, still readable while other thread_locals are destroyed
+thread_local bool cache_destroyed = false;
+
+ThreadCache::~ThreadCache() {
+    for (std::size_t cls = 0; cls < ClassCount; cls++) {
+        while (FreeBlock* block = heads[cls]) {
+            heads[cls] = block->next;
+            ::operator delete(block);
+        }
+    }
+    cache_destroyed = true;
+}
+
+}  // namespace
+
+void* allocate(std::size_t size) {
+    if (size > MaxPooledSize)
+        return ::operator new(size);
+
+    std::size_t cls = size_class(size);
+    if (cache_destroyed)
+        return ::operator new(MinClassSize << cls);
+
+    FreeBlock*& head = cache.heads[cls];
+    if (!head) {
+        head = depot().take(cls);
+        if (!head)
+            return ::operator new(MinClassSize << cls);
+        cache.counts[cls] = BatchSize;
+    }
+    FreeBlock* block = head;
+    head = block->next;
+    cache.counts[cls]--;
+    return block;
+}
+
+void deallocate(void* p, std::size_t size) {
+    if (size > MaxPooledSize || cache_destroyed) {
+        ::operator delete(p);
+        return;
+    }
+
+    std::size_t cls = size_class(size);
+    FreeBlock* block = static_cast<FreeBlock*>(p);
+    block->next = cache.heads[cls];
+    cache.heads[cls] = block;
+    if (++cache.counts[cls] < CacheLimit)
+        return;
+
+    // hand the oldest BatchSize blocks to the depot
+    FreeBlock* last = cache.heads[cls];
+    for (std::size_t i = 1; i < CacheLimit - BatchSize; i++) last = last->next;
+    depot().put(cls, last->next);
+    last->next = nullptr;
+    cache.counts[cls] = CacheLimit - BatchSize;
+}
+
+}  // namespace task_memory
@@ -0,0 +1,157 @@
+#pragma once
+
+// Task representation of ThreadPool: a move-only callable that keeps small closures
+// inline, and a per-thread block cache for what does not fit (and for the shared
+// state of the futures add_task returns).
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace task_memory {
+
+// Blocks up to MaxPooledSize bytes come from a per-thread cache of the block's size
+// class; blocks freed on another thread than the one that allocated them flow back
+// through a shared depot in batches. Larger blocks use the global operator new.
+static constexpr std::size_t MaxPooledSize = 512;
+
+void* allocate(std::size_t size);
+void deallocate(void* block, std::size_t size);
+
+template <typename T>
+struct PoolAllocator {
+    using value_type = T;
+
+    PoolAllocator() = default;
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>&) {}
+
+    T* allocate(std::size_t n) {
+        if constexpr (alignof(T) > alignof(std::max_align_t))
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+        return static_cast<T*>(task_memory::allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, std::size_t n) {
+        if constexpr (alignof(T) > alignof(std::max_align_t)) {
+            ::operator delete(p, std::align_val_t(alignof(T)));
+            return;
+        }
+        task_memory::deallocate(p, n * sizeof(T));
+    }
+
+    template <typename U>
+    bool operator==(const PoolAllocator<U>&) const {
+        return true;
+    }
+    template <typename U>
+    bool operator!=(const PoolAllocator<U>&) const {
+        return false;
+    }
+};
+
+}  // namespace task_memory
+
+// Move-only std::function<void()> replacement. Closures of up to InlineSize bytes
+// that can be moved without throwing are stored in place, larger ones in a pooled
+// block, so building and running a task does not touch the global allocator.
+class UniqueTask final {
+   public:
+    static constexpr std::size_t InlineSize = 48;
+
+    UniqueTask() = default;
+
+    template <class F,
+              class = typename std::enable_if<
+                  !std::is_same<typename std::decay<F>::type, UniqueTask>::value>::type>
+    UniqueTask(F&& f) {
+        using Fn = typename std::decay<F>::type;
+        if constexpr (sizeof(Fn) <= InlineSize && alignof(Fn) <= alignof(std::max_align_t) &&
+                      std::is_nothrow_move_constructible<Fn>::value) {
+            new (storage) Fn(std::forward<F>(f));
+            ops = &InlineOps<Fn>::ops;
+        } else {
+            task_memory::PoolAllocator<Fn> allocator;
+            Fn* fn = allocator.allocate(1);
+            try {
+                new (fn) Fn(std::forward<F>(f));
+            } catch (...) {
+                allocator.deallocate(fn, 1);
+                throw;
+            }
+            *reinterpret_cast<Fn**>(storage) = fn;
+            ops = &HeapOps<Fn>::ops;
+        }
+    }
+
+    UniqueTask(UniqueTask&& other) noexcept : ops(other.ops) {
+        if (ops) {
+            ops->move(storage, other.storage);
+            other.ops = nullptr;
+        }
+    }
+
+    UniqueTask& operator=(UniqueTask&& other) noexcept {
+        if (this != &other) {
+            reset();
+            ops = other.ops;
+            if (ops) {
+                ops->move(storage, other.storage);
+                other.ops = nullptr;
+            }
+        }
+        return *this;
+    }
+
+    UniqueTask(const UniqueTask&) = delete;
+    UniqueTask& operator=(const UniqueTask&) = delete;
+
+    ~UniqueTask() { reset(); }
+
+    explicit operator bool() const { return ops != nullptr; }
+
+    void operator()() { ops->invoke(storage); }
+
+   private:
+    struct Ops {
+        void (*invoke)(void* storage);
+        // move-construct into dst and destroy the source
+        void (*move)(void* dst, void* src);
+        void (*destroy)(void* storage);
+    };
+
+    template <class Fn>
+    struct InlineOps {
+        static void invoke(void* s) { (*static_cast<Fn*>(s))(); }
+        static void move(void* dst, void* src) {
+            new (dst) Fn(std::move(*static_cast<Fn*>(src)));
+            static_cast<Fn*>(src)->~Fn();
+        }
+        static void destroy(void* s) { static_cast<Fn*>(s)->~Fn(); }
+        static constexpr Ops ops = {invoke, move, destroy};
+    };
+
+    template <class Fn>
+    struct HeapOps {
+        static Fn* get(void* s) { return *static_cast<Fn**>(s); }
+        static void invoke(void* s) { (*get(s))(); }
+        static void move(void* dst, void* src) { *static_cast<Fn**>(dst) = get(src); }
+        static void destroy(void* s) {
+            Fn* fn = get(s);
+            fn->~Fn();
+            task_memory::PoolAllocator<Fn>().deallocate(fn, 1);
+        }
+        static constexpr Ops ops = {invoke, move, destroy};
+    };
+
+    void reset() {
+        if (ops) {
+            ops->destroy(storage);
+            ops = nullptr;
+        }
+    }
+
+    alignas(std::max_align_t) unsigned char storage[InlineSize];
+    const Ops* ops = nullptr;
+};
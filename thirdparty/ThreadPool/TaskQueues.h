@@ -0,0 +1,212 @@
+#pragma once
+
+// Queues behind ThreadPool's work-stealing scheduling. Both hold pointers and never
+// own what they hold.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Chase-Lev deque (with the C11 memory orders of Le et al., "Correct and Efficient
+// Work-Stealing for Weak Memory Models"). Only the owning worker pushes and pops at
+// the bottom, any thread may steal from the top.
+template <typename T>
+class WorkStealingDeque final {
+   public:
+    explicit WorkStealingDeque(std::size_t capacity = 256) {
+        buffers.emplace_back(new Buffer(capacity));
+        buffer.store(buffers.back().get(), std::memory_order_relaxed);
+    }
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    void operator=(const WorkStealingDeque&) = delete;
+
+    // owner only
+    void push(T* item) {
+        std::int64_t b = bottom.load(std::memory_order_relaxed);
+        std::int64_t t = top.load(std::memory_order_acquire);
+        Buffer* buf = buffer.load(std::memory_order_relaxed);
+        if (b - t > static_cast<std::int64_t>(buf->mask)) {
+            buf = grow(buf, t, b);
+        }
+        buf->put(b, item);
+        // a release store rather than the paper's release fence, same cost on x86
+        // and understood by ThreadSanitizer
+        bottom.store(b + 1, std::memory_order_release);
+    }
+
+    // owner only, newest first
+    T* pop() {
+        std::int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+        Buffer* buf = buffer.load(std::memory_order_relaxed);
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t t = top.load(std::memory_order_relaxed);
+
+        if (t > b) {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        T* item = buf->get(b);
+        if (t == b) {
+            // last item, race the thieves for it
+            if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                             std::memory_order_relaxed))
+                item = nullptr;
+            bottom.store(b + 1, std::memory_order_relaxed);
+        }
+        return item;
+    }
+
+    // any thread, oldest first. nullptr when empty or when another thread won the race
+    T* steal() {
+        std::int64_t t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t b = bottom.load(std::memory_order_acquire);
+        if (t >= b)
+            return nullptr;
+
+        T* item = buffer.load(std::memory_order_acquire)->get(t);
+        if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                         std::memory_order_relaxed))
+            return nullptr;
+        return item;
+    }
+
+    bool empty() const {
+        return bottom.load(std::memory_order_seq_cst) <= top.load(std::memory_order_seq_cst);
+    }
+
+   private:
+    struct Buffer {
+        explicit Buffer(std::size_t capacity) : mask(capacity - 1), items(capacity) {}
+        T* get(std::int64_t i) const { return items[i & mask].load(std::memory_order_relaxed); }
+        void put(std::int64_t i, T* item) {
+            items[i & mask].store(item, std::memory_order_relaxed);
+        }
+
+        const std::size_t mask;
+        std::vector<std::atomic<T*>> items;
+    };
+
+    Buffer* grow(Buffer* old, std::int64_t t, std::int64_t b) {
+        buffers.emplace_back(new Buffer(2 * (old->mask + 1)));
+        Buffer* grown = buffers.back().get();
+        for (std::int64_t i = t; i < b; i++) grown->put(i, old->get(i));
+        // thieves may still read the old buffer, it is kept until the deque goes away
+        buffer.store(grown, std::memory_order_release);
+        return grown;
+    }
+
+    alignas(64) std::atomic<std::int64_t> top{0};
+    alignas(64) std::atomic<std::int64_t> bottom{0};
+    std::atomic<Buffer*> buffer;
+    // every buffer ever used, owner only
+    std::vector<std::unique_ptr<Buffer>> buffers;
+};
+
+// Multi-producer multi-consumer queue for tasks submitted from outside the pool: a
+// bounded lock-free ring (Vyukov's MPMC queue) that spills into a locked deque when
+// a burst does not fit. Items spilled are not ordered against the ring.
+template <typename T>
+class InjectionQueue final {
+   public:
+    // capacity must be a power of two
+    explicit InjectionQueue(std::size_t capacity = 4096) : mask(capacity - 1), cells(capacity) {
+        for (std::size_t i = 0; i < capacity; i++)
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    InjectionQueue(const InjectionQueue&) = delete;
+    void operator=(const InjectionQueue&) = delete;
+
+    void push(T* item) {
+        if (push_ring(item))
+            return;
+        std::lock_guard<std::mutex> lock(overflow_mutex);
+        overflow.push_back(item);
+        overflow_size.fetch_add(1, std::memory_order_release);
+    }
+
+    T* pop() {
+        if (T* item = pop_ring())
+            return item;
+        if (overflow_size.load(std::memory_order_acquire) == 0)
+            return nullptr;
+
+        std::lock_guard<std::mutex> lock(overflow_mutex);
+        if (overflow.empty())
+            return nullptr;
+        T* item = overflow.front();
+        overflow.pop_front();
+        overflow_size.fetch_sub(1, std::memory_order_relaxed);
+        return item;
+    }
+
+    bool empty() const {
+        std::size_t pos = dequeue_pos.load(std::memory_order_seq_cst);
+        const Cell& cell = cells[pos & mask];
+        return cell.sequence.load(std::memory_order_seq_cst) != pos + 1 &&
+               overflow_size.load(std::memory_order_seq_cst) == 0;
+    }
+
+   private:
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        T* item;
+    };
+
+    bool push_ring(T* item) {
+        std::size_t pos = enqueue_pos.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &cells[pos & mask];
+            std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+            std::intptr_t diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->item = item;
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    T* pop_ring() {
+        std::size_t pos = dequeue_pos.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &cells[pos & mask];
+            std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+            std::intptr_t diff =
+                static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                return nullptr;
+            } else {
+                pos = dequeue_pos.load(std::memory_order_relaxed);
+            }
+        }
+        T* item = cell->item;
+        cell->sequence.store(pos + mask + 1, std::memory_order_release);
+        return item;
+    }
+
+    const std::size_t mask;
+    std::vector<Cell> cells;
+    alignas(64) std::atomic<std::size_t> enqueue_pos{0};
+    alignas(64) std::atomic<std::size_t> dequeue_pos{0};
+
+    std::mutex overflow_mutex;
+    std::deque<T*> overflow;
+    std::atomic<std::size_t> overflow_size{0};
+};
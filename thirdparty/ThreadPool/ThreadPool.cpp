@@ -1,4 +1,464 @@
 #include "ThreadPool.h"
 
+#include <cstdlib>
+#include <fstream>
+#include <unordered_map>
+
+#ifdef __linux__
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 thread_local ThreadPool* ThreadPool::tp_owner = nullptr;
-thread_local size_t ThreadPool::task_id = 4294967296;
\ No newline at end of file
+thread_local size_t ThreadPool::task_id = 4294967296;
+thread_local size_t ThreadPool::worker_index = 0;
+thread_local uint64_t ThreadPool::steal_seed = 0;
+thread_local int64_t ThreadPool::nested_busy_ns = 0;
+
+ThreadPool::ThreadPool(const std::string& name, size_t sz, Scheduling scheduling)
+    : ThreadPool(name, Config{sz, scheduling, {}, 0}) {}
+
+ThreadPool::ThreadPool(const std::string& name, const Config& config)
+    : name(name), scheduling(config.scheduling), cpus(config.cpus), nice(config.nice) {
+    if (scheduling == Scheduling::WorkStealing) {
+        for (size_t i = 0; i < config.size; ++i)
+            worker_queues.emplace_back(new WorkStealingDeque<TaskT>());
+    }
+    for (size_t i = 0; i < config.size; ++i)
+        workers.emplace_back([this, i]() { worker_main(i); });
+}
+
+namespace {
+
+struct NamedPools {
+    std::mutex mutex;
+    std::unordered_map<std::string, ThreadPool::Config> configs;
+    std::unordered_map<std::string, std::unique_ptr<ThreadPool>> pools;
+};
+
+NamedPools& named_pools() {
+    static NamedPools instance;
+    return instance;
+}
+
+ThreadPool::Config default_config(const std::string& name) {
+    ThreadPool::Config config;
+    if (name == ThreadPool::kIoPool) {
+        config.size = 2;
+    } else if (name == ThreadPool::kBackgroundPool) {
+        config.size = 1;
+        config.nice = 10;
+    }
+    return config;
+}
+
+bool parse_int(const std::string& text, int& value) {
+    char* end = nullptr;
+    long parsed = std::strtol(text.c_str(), &end, 10);
+    if (text.empty() || *end != '\0')
+        return false;
+    value = static_cast<int>(parsed);
+    return true;
+}
+
+// "0-3+6" -> 0 1 2 3 6
+bool parse_cpus(const std::string& text, std::vector<int>& cpus) {
+    std::stringstream items(text);
+    std::string item;
+    while (std::getline(items, item, '+')) {
+        size_t dash = item.find('-');
+        int first, last;
+        if (dash == std::string::npos) {
+            if (!parse_int(item, first))
+                return false;
+            last = first;
+        } else if (!parse_int(item.substr(0, dash), first) ||
+                   !parse_int(item.substr(dash + 1), last)) {
+            return false;
+        }
+        if (first < 0 || last < first)
+            return false;
+        for (int cpu = first; cpu <= last; ++cpu) cpus.push_back(cpu);
+    }
+    return !cpus.empty();
+}
+
+}  // namespace
+
+ThreadPool& ThreadPool::Named(const std::string& name) {
+    NamedPools& named = named_pools();
+    std::lock_guard<std::mutex> lock(named.mutex);
+    auto& pool = named.pools[name];
+    if (!pool) {
+        auto config = named.configs.find(name);
+        pool.reset(new ThreadPool(
+            name, config != named.configs.end() ? config->second : default_config(name)));
+    }
+    return *pool;
+}
+
+bool ThreadPool::Configure(const std::string& name, const Config& config) {
+    NamedPools& named = named_pools();
+    std::lock_guard<std::mutex> lock(named.mutex);
+    if (named.pools.count(name))
+        return false;
+    named.configs[name] = config;
+    return true;
+}
+
+ThreadPool::Config ThreadPool::NamedConfig(const std::string& name) {
+    NamedPools& named = named_pools();
+    std::lock_guard<std::mutex> lock(named.mutex);
+    auto config = named.configs.find(name);
+    return config != named.configs.end() ? config->second : default_config(name);
+}
+
+bool ThreadPool::ConfigureFromSpec(const std::string& spec, std::string* error) {
+    auto fail = [error](const std::string& message) {
+        if (error)
+            *error = message;
+        return false;
+    };
+
+    std::vector<std::pair<std::string, Config>> parsed;
+    std::stringstream entries(spec);
+    std::string entry;
+    while (std::getline(entries, entry, ',')) {
+        if (entry.empty())
+            continue;
+
+        std::stringstream fields(entry);
+        std::string field;
+        std::getline(fields, field, ':');
+        size_t equals = field.find('=');
+        std::string name = field.substr(0, equals);
+        if (name.empty())
+            return fail("pool without a name in '" + entry + "'");
+
+        Config config = default_config(name);
+        int size = 0;
+        if (equals != std::string::npos && (!parse_int(field.substr(equals + 1), size) || size < 0))
+            return fail("bad size in '" + entry + "'");
+        if (size > 0)
+            config.size = size;
+
+        while (std::getline(fields, field, ':')) {
+            if (field.compare(0, 5, "cpus=") == 0) {
+                config.cpus.clear();
+                if (!parse_cpus(field.substr(5), config.cpus))
+                    return fail("bad cpu list in '" + entry + "'");
+            } else if (field.compare(0, 5, "nice=") == 0) {
+                if (!parse_int(field.substr(5), config.nice))
+                    return fail("bad nice level in '" + entry + "'");
+            } else {
+                return fail("unknown option '" + field + "' in '" + entry + "'");
+            }
+        }
+        parsed.emplace_back(name, config);
+    }
+
+    for (auto& pool : parsed) {
+        if (!Configure(pool.first, pool.second))
+            return fail("pool '" + pool.first + "' is already running");
+    }
+    return true;
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::unique_lock<std::mutex> lock(queue_mutex);
+        stop = true;
+    }
+    condition.notify_all();
+    for (auto& worker : workers) worker.join();
+}
+
+void ThreadPool::enqueue(TaskT&& task, bool subtask) {
+    PoolProfiler* instrumented = profiler.load(std::memory_order_acquire);
+    if (instrumented)
+        task.enqueued_ns = PoolProfiler::now_ns();
+
+    subtask = subtask && tp_owner == this;
+    if (scheduling == Scheduling::SharedQueue) {
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex);
+            // don't allow enqueuing if we are stopping, unless from a worker: the queue
+            // is drained before the workers exit
+            if (stop && tp_owner != this)
+                throw std::runtime_error("add task on stopped thread pool");
+            (subtask ? subtasks : tasks).emplace(std::move(task));
+        }
+        if (instrumented)
+            instrumented->on_enqueue();
+        condition.notify_one();
+        return;
+    }
+
+    // workers may still add tasks while the pool drains, they run them before exiting
+    if (subtask) {
+        worker_queues[worker_index]->push(make_node(std::move(task)));
+    } else {
+        if (stop.load(std::memory_order_acquire) && tp_owner != this)
+            throw std::runtime_error("add task on stopped thread pool");
+        injection.push(make_node(std::move(task)));
+    }
+    if (instrumented)
+        instrumented->on_enqueue();
+
+    // pairs with the fence in work_stealing_loop: either the worker about to sleep
+    // sees the task, or we see it among the sleepers
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleepers.load(std::memory_order_relaxed) > 0) {
+        // a worker between its last look at the queues and its wait holds the mutex
+        { std::lock_guard<std::mutex> lock(queue_mutex); }
+        condition.notify_one();
+    }
+}
+
+void ThreadPool::worker_main(size_t index) {
+    tp_owner = this;
+    worker_index = index;
+    task_id = kInvalidTaskID;
+    steal_seed = 0x9E3779B97F4A7C15ull * (index + 1);
+
+    // set thread name
+    // thread name is restricted to 16 characters, including the terminating null byte
+    std::string suffix = "[" + std::to_string(index) + "]";
+    std::string tname = this->name.substr(0, 15 - suffix.size()) + suffix;
+#ifdef _WIN32
+    HRESULT r = SetThreadDescription(GetCurrentThread(), tname);
+#elif __linux__
+    if (::pthread_setname_np(pthread_self(), tname.c_str()) != 0)
+        throw std::system_error(errno, std::system_category(), "failed to set thread name");
+#elif __APPLE__
+    if (::pthread_setname_np(tname.c_str()) != 0)
+        throw std::system_error(errno, std::system_category(), "failed to set thread name");
+#endif  // _WIN32
+
+    apply_worker_settings();
+
+    if (scheduling == Scheduling::WorkStealing) {
+        work_stealing_loop(index);
+    } else {
+        shared_queue_loop();
+    }
+}
+
+ThreadPool::TaskT* ThreadPool::make_node(TaskT&& task) {
+    return new (task_memory::allocate(sizeof(TaskT))) TaskT(std::move(task));
+}
+
+void ThreadPool::NodeDeleter::operator()(TaskT* node) const {
+    node->~TaskT();
+    task_memory::deallocate(node, sizeof(TaskT));
+}
+
+// Best effort: a CPU list or nice level the system refuses leaves the worker as it
+// was rather than failing the pool.
+void ThreadPool::apply_worker_settings() {
+#ifdef _WIN32
+    if (!cpus.empty()) {
+        DWORD_PTR mask = 0;
+        for (int cpu : cpus) {
+            if (cpu < static_cast<int>(sizeof(DWORD_PTR) * 8))
+                mask |= DWORD_PTR(1) << cpu;
+        }
+        if (mask)
+            SetThreadAffinityMask(GetCurrentThread(), mask);
+    }
+    if (nice != 0) {
+        int priority = nice >= 10  ? THREAD_PRIORITY_LOWEST
+                       : nice > 0  ? THREAD_PRIORITY_BELOW_NORMAL
+                       : nice > -10 ? THREAD_PRIORITY_ABOVE_NORMAL
+                                    : THREAD_PRIORITY_HIGHEST;
+        SetThreadPriority(GetCurrentThread(), priority);
+    }
+#elif __linux__
+    if (!cpus.empty()) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (int cpu : cpus) {
+            if (cpu < CPU_SETSIZE)
+                CPU_SET(cpu, &set);
+        }
+        ::pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    }
+    if (nice != 0) {
+        // on Linux the nice value is per thread
+        ::setpriority(PRIO_PROCESS, static_cast<id_t>(::syscall(SYS_gettid)), nice);
+    }
+#endif
+}
+
+void ThreadPool::run(TaskT& task) {
+    // tasks nest when a worker helps while waiting
+    size_t outer_task_id = task_id;
+    task_id = task.id;
+    if (task.enqueued_ns == 0) {
+        task.func();
+    } else {
+        run_instrumented(task);
+    }
+    task_id = outer_task_id;
+}
+
+void ThreadPool::run_instrumented(TaskT& task) {
+    // tasks were only stamped after profiler_data was set
+    PoolProfiler* data = profiler_data.get();
+    int64_t start = PoolProfiler::now_ns();
+    data->on_start(start);
+
+    int64_t outer_nested_ns = nested_busy_ns;
+    nested_busy_ns = 0;
+    try {
+        task.func();
+    } catch (...) {
+        nested_busy_ns = outer_nested_ns;
+        throw;
+    }
+    int64_t end = PoolProfiler::now_ns();
+    data->on_finish(worker_index, task.id, task.enqueued_ns, start, end,
+                    end - start - nested_busy_ns);
+    nested_busy_ns = outer_nested_ns + (end - start);
+}
+
+void ThreadPool::enable_instrumentation(const PoolProfiler::Options& options) {
+    std::lock_guard<std::mutex> lock(instrumentation_mutex);
+    if (!profiler_data)
+        profiler_data.reset(new PoolProfiler(name, workers.size(), options));
+    profiler.store(profiler_data.get(), std::memory_order_release);
+}
+
+void ThreadPool::disable_instrumentation() { profiler.store(nullptr, std::memory_order_release); }
+
+void ThreadPool::set_task_label(uint16_t id, const std::string& label) {
+    std::lock_guard<std::mutex> lock(instrumentation_mutex);
+    task_labels[id] = label;
+}
+
+PoolStats ThreadPool::stats() const {
+    std::lock_guard<std::mutex> lock(instrumentation_mutex);
+    return profiler_data ? profiler_data->stats(task_labels) : PoolStats();
+}
+
+bool ThreadPool::write_chrome_trace(const std::string& path) const {
+    std::lock_guard<std::mutex> lock(instrumentation_mutex);
+    if (!profiler_data)
+        return false;
+    std::ofstream out(path);
+    profiler_data->write_chrome_trace(out, task_labels);
+    out.close();
+    return static_cast<bool>(out);
+}
+
+bool ThreadPool::run_pending_task() {
+    if (!is_owner())
+        return false;
+
+    // only subtasks: a posted task may be a request runner that serves a whole queue
+    if (scheduling == Scheduling::WorkStealing) {
+        Node task(worker_queues[worker_index]->pop());
+        if (!task)
+            return false;
+        run(*task);
+        return true;
+    }
+
+    TaskT task;
+    {
+        std::unique_lock<std::mutex> lock(queue_mutex);
+        if (subtasks.empty())
+            return false;
+        task = std::move(subtasks.front());
+        subtasks.pop();
+    }
+    run(task);
+    return true;
+}
+
+void ThreadPool::shared_queue_loop() {
+    TaskT task;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex);
+            condition.wait(lock, [this] {
+                return this->stop || !this->tasks.empty() || !this->subtasks.empty();
+            });
+            // subtasks first, someone is waiting for them
+            std::queue<TaskT>& queue = subtasks.empty() ? tasks : subtasks;
+            if (stop && queue.empty())
+                return;
+            task = std::move(queue.front());
+            queue.pop();
+        }
+        run(task);
+    }
+}
+
+ThreadPool::TaskT* ThreadPool::find_task(size_t index, uint64_t& rng) {
+    if (TaskT* task = worker_queues[index]->pop())
+        return task;
+    if (TaskT* task = injection.pop())
+        return task;
+
+    // xorshift, only to spread the thieves over the victims
+    rng ^= rng << 13;
+    rng ^= rng >> 7;
+    rng ^= rng << 17;
+    size_t n = worker_queues.size();
+    size_t first = rng % n;
+    for (size_t i = 0; i < n; ++i) {
+        size_t victim = (first + i) % n;
+        if (victim == index)
+            continue;
+        if (TaskT* task = worker_queues[victim]->steal())
+            return task;
+    }
+    return nullptr;
+}
+
+bool ThreadPool::has_work() const {
+    if (!injection.empty())
+        return true;
+    for (auto& queue : worker_queues) {
+        if (!queue->empty())
+            return true;
+    }
+    return false;
+}
+
+void ThreadPool::work_stealing_loop(size_t index) {
+    int idle_rounds = 0;
+    while (true) {
+        if (TaskT* task = find_task(index, steal_seed)) {
+            Node owned(task);
+            run(*owned);
+            idle_rounds = 0;
+            continue;
+        }
+
+        // a steal that lost a race looks like an empty queue, look a few more times
+        // before paying for a sleep and a wakeup
+        if (++idle_rounds < kSpinRounds) {
+            std::this_thread::yield();
+            continue;
+        }
+        idle_rounds = 0;
+
+        std::unique_lock<std::mutex> lock(queue_mutex);
+        sleepers.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (has_work()) {
+            sleepers.fetch_sub(1, std::memory_order_relaxed);
+            continue;
+        }
+        if (stop) {
+            sleepers.fetch_sub(1, std::memory_order_relaxed);
+            return;
+        }
+        condition.wait(lock);
+        sleepers.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
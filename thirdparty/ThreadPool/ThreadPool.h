@@ -1,16 +1,32 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <exception>
 #include <functional>
 #include <future>
+#include <iterator>
 #include <memory>
 #include <mutex>
 #include <queue>
 #include <sstream>
 #include <stdexcept>
 #include <thread>
+#include <tuple>
+#include <type_traits>
 #include <vector>
 
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#include <coroutine>
+#define THREAD_POOL_COROUTINES 1
+#endif
+
+#include "Instrumentation.h"
+#include "Task.h"
+#include "TaskQueues.h"
+
 #ifdef _WIN32
 #include <processthreadsapi.h>
 #include <windows.h>
@@ -19,18 +35,82 @@
 #include <pthread.h>
 #endif
 
+template <class T>
+class Future;
+namespace future_detail {
+template <class R>
+struct Unwrap;
+struct ScheduleAwaiter;
+}  // namespace future_detail
+
 class ThreadPool final {
    public:
+    // How idle workers find their next task.
+    enum class Scheduling {
+        // one FIFO queue behind one mutex
+        SharedQueue,
+        // a deque per worker for the tasks it adds; other tasks go through a
+        // lock-free injection queue and idle workers steal from random victims
+        WorkStealing,
+    };
+
     static ThreadPool& GlobalPool() {
-        static ThreadPool global_thread_pool("thread_pool", std::thread::hardware_concurrency());
+        static ThreadPool global_thread_pool("thread_pool", std::thread::hardware_concurrency(),
+                                             Scheduling::WorkStealing);
         return global_thread_pool;
     }
 
+    struct Config {
+        size_t size = std::thread::hardware_concurrency();
+        Scheduling scheduling = Scheduling::WorkStealing;
+        // CPUs the workers may run on, any when empty (Linux and Windows)
+        std::vector<int> cpus;
+        // niceness of the workers, 0 keeps the creating thread's (Linux; Windows maps
+        // it to a thread priority)
+        int nice = 0;
+    };
+
+    // Names of the pools the services split their work into. The defaults are sized
+    // so that the four of them together do not oversubscribe the machine by much:
+    // io runs IPC sessions and cheap handlers (2 workers), decode and inference the
+    // CPU-heavy stages (one worker per CPU each, only one of them is busy in a given
+    // service), background low-priority maintenance (1 worker, nice 10).
+    static constexpr char kIoPool[] = "io";
+    static constexpr char kDecodePool[] = "decode";
+    static constexpr char kInferencePool[] = "inference";
+    static constexpr char kBackgroundPool[] = "background";
+
+    // The pool called name, created on first use with the Config given to
+    // Configure() or else the default for that name.
+    static ThreadPool& Named(const std::string& name);
+
+    // Set the Config of a named pool. false once the pool has been created.
+    static bool Configure(const std::string& name, const Config& config);
+
+    // The Config the pool called name has, or will be created with.
+    static Config NamedConfig(const std::string& name);
+
+    // Configure named pools from a command line flag such as
+    //   "io=2,decode=6:cpus=2-7,background=1:nice=15:cpus=0+1"
+    // i.e. comma separated name=size entries, each optionally followed by :cpus=LIST
+    // (ranges and single CPUs joined by '+') and :nice=N. A size of 0 keeps the
+    // default. On a malformed spec nothing is configured and error says why.
+    static bool ConfigureFromSpec(const std::string& spec, std::string* error = nullptr);
+
+    ThreadPool(const std::string& name, size_t sz = std::thread::hardware_concurrency(),
+               Scheduling scheduling = Scheduling::SharedQueue);
+    ThreadPool(const std::string& name, const Config& config);
+    ThreadPool(const ThreadPool&) = delete;
+    void operator=(const ThreadPool&) = delete;
+    ~ThreadPool();
+
     struct TaskT {
         TaskT() {}
-        TaskT(size_t i, std::function<void()> f) : id(i), func(f) {}
+        TaskT(size_t i, UniqueTask f) : id(i), func(std::move(f)) {}
         uint16_t id;
-        std::function<void()> func;
+        // PoolProfiler::now_ns() when added, 0 while instrumentation is off
+        int64_t enqueued_ns = 0;
+        UniqueTask func;
     };
 
     size_t size() const { return workers.size(); }
@@ -38,117 +118,219 @@ class ThreadPool final {
     // check if the calling thread is a worker of this thread pool
     bool is_owner() const { return tp_owner == this; }
 
-    // Add task without specifying task id
+    // the pool the calling thread is a worker of, nullptr outside of any pool
+    static ThreadPool* current() { return tp_owner; }
+
+    // Add task without specifying task id. Workers may add tasks too, those are
+    // their subtasks (see wait()).
     template <class F, class... Args>
     auto add_task(F&& f, Args&&... args) -> std::future<typename std::result_of<F(Args...)>::type> {
-        if (tp_owner == this)
-            throw std::logic_error("add task in worker thread");
-
-        auto task =
-            std::make_shared<std::packaged_task<typename std::result_of<F(Args...)>::type()>>(
-                std::bind(std::forward<F>(f), std::forward<Args>(args)...));
-
-        auto res = task->get_future();
-        {
-            std::unique_lock<std::mutex> lock(queue_mutex);
-            // don't allow enqueuing if we are stopping
-            if (stop)
-                throw std::runtime_error("add task on stopped thread pool");
-            tasks.emplace(0u, [task]() { (*task)(); });
-        }
-        condition.notify_one();
-        return res;
+        return add_taski(std::forward<F>(f), 0u, std::forward<Args>(args)...);
     }
 
     // Similar to add_task, but specify thread id
     template <class F, class... Args>
     auto add_taski(F&& f, uint16_t id, Args&&... args)
         -> std::future<typename std::result_of<F(Args...)>::type> {
-        if (tp_owner == this)
-            throw std::logic_error("add task in worker thread");
-
-        auto task =
-            std::make_shared<std::packaged_task<typename std::result_of<F(Args...)>::type()>>(
-                std::bind(std::forward<F>(f), std::forward<Args>(args)...));
-
-        auto res = task->get_future();
-        {
-            std::unique_lock<std::mutex> lock(queue_mutex);
-            // don't allow enqueuing if we are stopping
-            if (stop)
-                throw std::runtime_error("add task on stopped thread pool");
-            tasks.emplace(id, [task]() { (*task)(); });
-        }
-        condition.notify_one();
+        using R = typename std::result_of<F(Args...)>::type;
+
+        // the shared state comes from the task block cache, the closure holding the
+        // promise usually fits in the task itself
+        std::promise<R> promise(std::allocator_arg, task_memory::PoolAllocator<R>());
+        auto res = promise.get_future();
+        enqueue(TaskT(id, [promise = std::move(promise), f = std::forward<F>(f),
+                           args = std::make_tuple(std::forward<Args>(args)...)]() mutable {
+            try {
+                // arguments are passed as lvalues, like std::bind does
+                if constexpr (std::is_void<R>::value) {
+                    std::apply(f, args);
+                    promise.set_value();
+                } else {
+                    promise.set_value(std::apply(f, args));
+                }
+            } catch (...) {
+                promise.set_exception(std::current_exception());
+            }
+        }));
         return res;
     }
 
-    thread_local static size_t task_id;
-    size_t GetTaskID() const { return is_owner() ? task_id : 0u; }
+    // Fire and forget: run f on the pool without a future to report its result. f must
+    // not throw, an escaping exception terminates the program like in a std::thread.
+    // Posted by a worker, f is still no subtask of it: waiting workers never run it.
+    template <class F>
+    void post(F&& f) {
+        enqueue(TaskT(0u, UniqueTask(std::forward<F>(f))), false);
+    }
 
-   private:
-    ThreadPool(const std::string& name, size_t sz = std::thread::hardware_concurrency())
-        : name(name) {
-        for (size_t i = 0; i < sz; ++i)
-            workers.emplace_back([this, i]() {
-                tp_owner = this;
-
-                // set thread name
-                // thread name is restricted to 16 characters, including the terminating null byte
-                std::string suffix = "[" + std::to_string(i) + "]";
-                std::string tname = this->name.substr(0, 15 - suffix.size()) + suffix;
-#ifdef _WIN32
-                HRESULT r = SetThreadDescription(GetCurrentThread(), tname);
-#elif __linux__
-                if (::pthread_setname_np(pthread_self(), tname.c_str()) != 0)
-                    throw std::system_error(errno, std::system_category(),
-                                            "failed to set thread name");
-#elif __APPLE__
-                if (::pthread_setname_np(tname.c_str()) != 0)
-                    throw std::system_error(errno, std::system_category(),
-                                            "failed to set thread name");
-#endif  // _WIN32
-
-                TaskT task;
-                while (true) {
-                    {
-                        std::unique_lock<std::mutex> lock(queue_mutex);
-                        condition.wait(lock, [this] { return this->stop || !this->tasks.empty(); });
-                        if (stop && tasks.empty())
-                            return;
-                        task = std::move(tasks.front());
-                        tasks.pop();
-                    }
-
-                    task_id = task.id;
-                    task.func();
-                    task_id = kInvalidTaskID;
-                }
-            });
+    // Run f on the pool and return a Future of its result that continuations can be
+    // attached to (Future.h). A Future returned by f is unwrapped.
+    template <class F>
+    auto async(F&& f)
+        -> Future<typename future_detail::Unwrap<typename std::result_of<F()>::type>::type>;
+
+#ifdef THREAD_POOL_COROUTINES
+    // co_await pool.schedule() continues the coroutine on a worker of this pool, right
+    // away if it already runs on one.
+    future_detail::ScheduleAwaiter schedule();
+#endif
+
+    // Wait for a task of this pool. A worker runs its queued subtasks meanwhile instead
+    // of blocking, so a task waiting on tasks it added cannot starve the pool of
+    // workers. It never picks up posted or outside tasks, which could be anything up to
+    // a whole queue of requests. Outside the pool this simply blocks.
+    template <class T>
+    void wait(const std::future<T>& future) {
+        if (!is_owner()) {
+            future.wait();
+            return;
+        }
+        while (future.wait_for(std::chrono::seconds(0)) == std::future_status::timeout) {
+            if (run_pending_task())
+                continue;
+            // nothing left to help with, the task runs on another worker
+            future.wait_for(kHelpPollInterval);
+        }
     }
-    const size_t kInvalidTaskID = 8832151515;
-    ThreadPool(const ThreadPool&) = delete;
-    void operator=(const ThreadPool&) = delete;
 
-    ~ThreadPool() {
-        {
-            std::unique_lock<std::mutex> lock(queue_mutex);
-            stop = true;
+    // Run one queued subtask on the calling worker: with WorkStealing from its own
+    // deque, with SharedQueue one any worker added. false if there is none or the
+    // caller is not a worker of this pool.
+    bool run_pending_task();
+
+    // Call fn(chunk_begin, chunk_end) on consecutive chunks of [begin, end), each at
+    // least grain long, in parallel on the pool and the calling thread. Returns when
+    // all chunks are done and rethrows the first exception thrown by fn. Safe to call
+    // from a worker.
+    template <class F>
+    void parallel_for(size_t begin, size_t end, size_t grain, F&& fn) {
+        if (begin >= end)
+            return;
+
+        // a few chunks per worker keeps them busy without one task per element
+        size_t max_chunks = std::max<size_t>(1, size() * 4);
+        size_t chunk = std::max({grain, size_t(1), (end - begin + max_chunks - 1) / max_chunks});
+
+        std::exception_ptr error;
+        auto run_inline = [&](size_t b, size_t e) {
+            try {
+                fn(b, e);
+            } catch (...) {
+                if (!error)
+                    error = std::current_exception();
+            }
+        };
+
+        std::vector<std::future<void>> chunks;
+        for (size_t b = begin + std::min(chunk, end - begin); b < end; b += chunk) {
+            size_t e = b + std::min(chunk, end - b);
+            try {
+                chunks.push_back(add_task([&fn, b, e] { fn(b, e); }));
+            } catch (const std::runtime_error&) {
+                // stopped pool
+                run_inline(b, e);
+            }
+        }
+        run_inline(begin, begin + std::min(chunk, end - begin));
+
+        for (auto& future : chunks) {
+            wait(future);
+            try {
+                future.get();
+            } catch (...) {
+                if (!error)
+                    error = std::current_exception();
+            }
         }
-        condition.notify_all();
-        for (auto& worker : workers) worker.join();
+        if (error)
+            std::rethrow_exception(error);
     }
 
+    // out[i] = fn(first[i]) for every element of [first, last), with parallel_for.
+    // Both iterators must be random access.
+    template <class InputIt, class OutputIt, class F>
+    OutputIt parallel_transform(InputIt first, InputIt last, OutputIt out, F&& fn,
+                                size_t grain = 1) {
+        size_t n = std::distance(first, last);
+        parallel_for(0, n, grain, [&](size_t b, size_t e) {
+            for (size_t i = b; i < e; ++i) out[i] = fn(first[i]);
+        });
+        return out + n;
+    }
+
+    thread_local static size_t task_id;
+    size_t GetTaskID() const { return is_owner() ? task_id : 0u; }
+
+    // Instrumentation (Instrumentation.h): queue depth, wait and run time per task id,
+    // worker utilization and a Chrome trace. Off by default, which costs a relaxed
+    // load per added task. options only apply the first time it is enabled; the data
+    // is kept when it is disabled again.
+    void enable_instrumentation(const PoolProfiler::Options& options = {});
+    void disable_instrumentation();
+    // name under which the tasks added with add_taski(f, id) are reported
+    void set_task_label(uint16_t id, const std::string& label);
+    // empty unless instrumentation was enabled
+    PoolStats stats() const;
+    // false if instrumentation was never enabled or the file cannot be written
+    bool write_chrome_trace(const std::string& path) const;
+
    private:
+    // A task added by a worker is its subtask unless posted.
+    void enqueue(TaskT&& task, bool subtask = true);
+    void worker_main(size_t index);
+    void apply_worker_settings();
+    void shared_queue_loop();
+    void work_stealing_loop(size_t index);
+    TaskT* find_task(size_t index, uint64_t& rng);
+    bool has_work() const;
+    void run(TaskT& task);
+    void run_instrumented(TaskT& task);
+
+    // work-stealing queues hold TaskT nodes from the task block cache
+    struct NodeDeleter {
+        void operator()(TaskT* node) const;
+    };
+    using Node = std::unique_ptr<TaskT, NodeDeleter>;
+    static TaskT* make_node(TaskT&& task);
+
+    const size_t kInvalidTaskID = 8832151515;
+    // rounds an idle work-stealing worker keeps looking before it sleeps
+    static constexpr int kSpinRounds = 64;
+    // how long wait() blocks between looks for tasks to help with
+    static constexpr std::chrono::microseconds kHelpPollInterval{100};
+
     thread_local static ThreadPool* tp_owner;
+    thread_local static size_t worker_index;
+    thread_local static uint64_t steal_seed;
+    // time spent in instrumented tasks nested in the one the worker runs
+    thread_local static int64_t nested_busy_ns;
     std::vector<std::thread> workers;
-    // std::queue<std::function<void()>> tasks;
+    std::string name;
+    const Scheduling scheduling;
+    const std::vector<int> cpus;
+    const int nice;
+
+    // SharedQueue, the tasks workers added apart so that waiting workers find them
     std::queue<TaskT> tasks;
+    std::queue<TaskT> subtasks;
 
-    std::string name;
+    // WorkStealing
+    std::vector<std::unique_ptr<WorkStealingDeque<TaskT>>> worker_queues;
+    InjectionQueue<TaskT> injection;
+    std::atomic<size_t> sleepers{0};
+
+    // guards tasks; the work-stealing workers sleep on it
     std::mutex queue_mutex;
     std::condition_variable condition;
-    bool stop = false;
+    std::atomic<bool> stop{false};
+
+    // created by the first enable_instrumentation() and kept until the pool goes away;
+    // profiler is null while instrumentation is off
+    std::unique_ptr<PoolProfiler> profiler_data;
+    std::atomic<PoolProfiler*> profiler{nullptr};
+    // guards creating profiler_data and task_labels
+    mutable std::mutex instrumentation_mutex;
+    PoolProfiler::Labels task_labels;
 };
 
 // shortcut for waiting for a group of task to finish
@@ -160,14 +342,23 @@ class result_set final {
     result_set() {}
     void insert(FT&& v) { results.push_back(std::forward<FT>(v)); }
     size_t size() const { return results.size(); }
-    T get(size_t i) { return results[i].get(); }
+    // The getters help with the pool's queued subtasks while waiting when called from a
+    // worker (ThreadPool::wait), so a task may wait on tasks it added.
+    T get(size_t i) {
+        help(results[i]);
+        return results[i].get();
+    }
     void get_all() {
-        for (auto&& result : results) result.get();
+        for (auto&& result : results) {
+            help(result);
+            result.get();
+        }
     }
     void get_all_with_except() {
         bool no_except = true;
         std::stringstream msg;
         for (auto&& result : results) try {
+                help(result);
                 result.get();
             } catch (std::exception& e) {
                 no_except = false;
@@ -182,5 +373,12 @@ class result_set final {
     }
 
    private:
+    static void help(const FT& result) {
+        if (ThreadPool* pool = ThreadPool::current())
+            pool->wait(result);
+    }
+
     std::vector<FT> results;
 };
+
+#include "Future.h"
@@ -0,0 +1,194 @@
+//
+// Task throughput of ThreadPool for each scheduling mode and way of submitting.
+// External submitter threads push a fixed number of tasks and wait for all of them;
+// the pool size goes from 1 to the maximum in powers of two. "tiny" tasks do next
+// to nothing and measure the per-task overhead, "medium" ones spin for about 10
+// microseconds.
+//
+// Submission: "legacy" builds each task the way add_task did before tasks became
+// move-only (bind, shared packaged_task, std::function), "add_task" returns a
+// future, "post" does not. allocs_per_task counts global operator new calls.
+//
+// usage: thread_pool_bench [--max-threads N] [--tasks N] [--submitters N]
+//                          [--format csv|json]
+//
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "ThreadPool.h"
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    size_t max_threads = 64;
+    size_t tasks = 200000;
+    size_t submitters = 1;
+    bool json = false;
+};
+
+static std::atomic<uint64_t> allocations{0};
+
+void* operator new(std::size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+enum class Submit { Legacy, AddTask, Post };
+
+static std::atomic<uint64_t> sink{0};
+
+static void tiny_task() { sink.fetch_add(1, std::memory_order_relaxed); }
+
+static void medium_task() {
+    auto until = Clock::now() + std::chrono::microseconds(10);
+    uint64_t x = 0;
+    while (Clock::now() < until) x += x * 31 + 7;
+    sink.fetch_add(x, std::memory_order_relaxed);
+}
+
+static void submit_and_wait(ThreadPool& pool, Submit submit, void (*task)(), size_t n) {
+    if (submit == Submit::Post) {
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::atomic<size_t> remaining{n};
+        for (size_t i = 0; i < n; i++) {
+            pool.post([&, task] {
+                task();
+                if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    cv.notify_one();
+                }
+            });
+        }
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&] { return remaining.load(std::memory_order_acquire) == 0; });
+        return;
+    }
+
+    std::vector<std::future<void>> futures;
+    futures.reserve(n);
+    for (size_t i = 0; i < n; i++) {
+        if (submit == Submit::Legacy) {
+            auto packaged = std::make_shared<std::packaged_task<void()>>(std::bind(task));
+            futures.push_back(packaged->get_future());
+            std::function<void()> func = [packaged]() { (*packaged)(); };
+            pool.post(std::move(func));
+        } else {
+            futures.push_back(pool.add_task(task));
+        }
+    }
+    for (auto& future : futures) future.get();
+}
+
+static double run(ThreadPool::Scheduling scheduling, Submit submit, size_t threads,
+                  void (*task)(), size_t tasks, size_t submitters, double& allocs_per_task) {
+    ThreadPool pool("bench", threads, scheduling);
+    // warm the task block caches up, as a long running service would have them
+    submit_and_wait(pool, submit, task, std::min<size_t>(tasks, 1024));
+
+    uint64_t allocations_before = allocations.load();
+    auto start = Clock::now();
+    std::vector<std::thread> producers;
+    for (size_t s = 0; s < submitters; s++) {
+        producers.emplace_back([&pool, submit, task, n = tasks / submitters] {
+            submit_and_wait(pool, submit, task, n);
+        });
+    }
+    for (auto& producer : producers) producer.join();
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    // thread creation of the producers is a handful, not per task
+    allocs_per_task = static_cast<double>(allocations.load() - allocations_before) / tasks;
+    return seconds;
+}
+
+static bool parse_options(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc)
+            return false;
+        if (arg == "--max-threads") {
+            options.max_threads = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--tasks") {
+            options.tasks = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--submitters") {
+            options.submitters = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--format") {
+            options.json = std::string(argv[++i]) == "json";
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parse_options(argc, argv, options)) {
+        std::cerr << "usage: thread_pool_bench [--max-threads N] [--tasks N] [--submitters N] "
+                     "[--format csv|json]"
+                  << std::endl;
+        return 1;
+    }
+
+    if (!options.json)
+        std::printf(
+            "scheduling,submit,task,threads,submitters,tasks,seconds,tasks_per_sec,ns_per_task,"
+            "allocs_per_task\n");
+
+    struct Kind {
+        const char* name;
+        void (*task)();
+        // medium tasks are far slower, run fewer of them
+        size_t divisor;
+    };
+    const Kind kinds[] = {{"tiny", tiny_task, 1}, {"medium", medium_task, 20}};
+    const std::pair<const char*, ThreadPool::Scheduling> modes[] = {
+        {"shared_queue", ThreadPool::Scheduling::SharedQueue},
+        {"work_stealing", ThreadPool::Scheduling::WorkStealing}};
+
+    const std::pair<const char*, Submit> submits[] = {
+        {"legacy", Submit::Legacy}, {"add_task", Submit::AddTask}, {"post", Submit::Post}};
+
+    for (const Kind& kind : kinds) {
+        size_t tasks = std::max(options.submitters, options.tasks / kind.divisor);
+        for (size_t threads = 1; threads <= options.max_threads; threads *= 2) {
+            for (const auto& mode : modes) {
+                for (const auto& submit : submits) {
+                    double allocs_per_task;
+                    double seconds = run(mode.second, submit.second, threads, kind.task, tasks,
+                                         options.submitters, allocs_per_task);
+                    size_t done = tasks / options.submitters * options.submitters;
+                    const char* format =
+                        options.json
+                            ? "{\"scheduling\":\"%s\",\"submit\":\"%s\",\"task\":\"%s\","
+                              "\"threads\":%zu,\"submitters\":%zu,\"tasks\":%zu,\"seconds\":%.6f,"
+                              "\"tasks_per_sec\":%.1f,\"ns_per_task\":%.1f,"
+                              "\"allocs_per_task\":%.2f}\n"
+                            : "%s,%s,%s,%zu,%zu,%zu,%.6f,%.1f,%.1f,%.2f\n";
+                    std::printf(format, mode.first, submit.first, kind.name, threads,
+                                options.submitters, done, seconds, done / seconds,
+                                seconds * 1e9 / done, allocs_per_task);
+                    std::fflush(stdout);
+                }
+            }
+        }
+    }
+    return 0;
+}
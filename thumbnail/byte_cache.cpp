@@ -0,0 +1,136 @@
+#include "byte_cache.h"
+
+#include <algorithm>
+
+// what an entry costs besides its key and bytes: the list node, the map node and the
+// shared string's control block, roughly
+static constexpr size_t EntryOverhead = 128;
+
+ThumbnailByteCache::ThumbnailByteCache(size_t capacity, size_t shard_count)
+    : shard_capacity(capacity / std::max<size_t>(1, shard_count)),
+      shards(std::max<size_t>(1, shard_count)) {}
+
+size_t ThumbnailByteCache::cost(const std::string& key, const Bytes& bytes) {
+    return key.size() + bytes->size() + EntryOverhead;
+}
+
+ThumbnailByteCache::Shard& ThumbnailByteCache::shard_of(const std::string& key) {
+    return shards[std::hash<std::string>()(key) % shards.size()];
+}
+
+std::vector<ThumbnailByteCache::Bytes> ThumbnailByteCache::get(const std::vector<std::string>& keys,
+                                                               const Loader& load) {
+    std::vector<Bytes> found(keys.size());
+
+    // the indices of keys by shard
+    std::vector<std::vector<size_t>> by_shard(shards.size());
+    for (size_t i = 0; i < keys.size(); i++) {
+        by_shard[&shard_of(keys[i]) - shards.data()].push_back(i);
+    }
+
+    std::vector<size_t> missing;
+    // the generation of each shard when its misses were found
+    std::vector<uint64_t> generations(shards.size());
+    for (size_t s = 0; s < shards.size(); s++) {
+        if (by_shard[s].empty()) {
+            continue;
+        }
+        Shard& shard = shards[s];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        generations[s] = shard.generation;
+        for (size_t i : by_shard[s]) {
+            auto it = shard.entries.find(keys[i]);
+            if (it == shard.entries.end()) {
+                shard.misses++;
+                missing.push_back(i);
+                continue;
+            }
+            shard.hits++;
+            shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+            found[i] = it->second->bytes;
+        }
+    }
+    if (missing.empty()) {
+        return found;
+    }
+
+    for (size_t i : missing) {
+        found[i] = load(keys[i]);
+    }
+
+    // missing is in shard order, so each shard is locked once; a shard that was
+    // written to while loading may have dropped what was loaded, none of it is kept
+    for (size_t first = 0; first < missing.size();) {
+        Shard& shard = shard_of(keys[missing[first]]);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        bool current = shard.generation == generations[&shard - shards.data()];
+        size_t last = first;
+        for (; last < missing.size() && &shard_of(keys[missing[last]]) == &shard; last++) {
+            size_t i = missing[last];
+            if (current && found[i] != nullptr) {
+                put_locked(shard, keys[i], found[i]);
+            }
+        }
+        first = last;
+    }
+    return found;
+}
+
+void ThumbnailByteCache::put(const std::string& key, Bytes bytes) {
+    Shard& shard = shard_of(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.generation++;
+    put_locked(shard, key, std::move(bytes));
+}
+
+void ThumbnailByteCache::put_locked(Shard& shard, const std::string& key, Bytes bytes) {
+    size_t size = cost(key, bytes);
+    // too large to be worth evicting everything else for
+    if (size > shard_capacity / 4) {
+        return;
+    }
+
+    auto it = shard.entries.find(key);
+    if (it != shard.entries.end()) {
+        shard.bytes -= cost(key, it->second->bytes);
+        it->second->bytes = std::move(bytes);
+        shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+    } else {
+        shard.lru.push_front(Entry{key, std::move(bytes)});
+        shard.entries.emplace(key, shard.lru.begin());
+    }
+    shard.bytes += size;
+
+    while (shard.bytes > shard_capacity) {
+        Entry& oldest = shard.lru.back();
+        shard.bytes -= cost(oldest.key, oldest.bytes);
+        shard.entries.erase(oldest.key);
+        shard.lru.pop_back();
+    }
+}
+
+void ThumbnailByteCache::erase(const std::string& key) {
+    Shard& shard = shard_of(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    // even when absent: the key may be loading
+    shard.generation++;
+    auto it = shard.entries.find(key);
+    if (it == shard.entries.end()) {
+        return;
+    }
+    shard.bytes -= cost(key, it->second->bytes);
+    shard.lru.erase(it->second);
+    shard.entries.erase(it);
+}
+
+ThumbnailByteCache::Stats ThumbnailByteCache::stats() const {
+    Stats stats;
+    for (const Shard& shard : shards) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        stats.hits += shard.hits;
+        stats.misses += shard.misses;
+        stats.entries += shard.entries.size();
+        stats.bytes += shard.bytes;
+    }
+    return stats;
+}
@@ -0,0 +1,71 @@
+//
+// Encoded thumbnails kept in memory for the grid, least recently used first out.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Byte strings by key, at most capacity bytes of them (keys and bookkeeping included).
+// The keys are spread over shards that each have their own lock and LRU list, so
+// concurrent readers rarely wait for one another.
+class ThumbnailByteCache final {
+   public:
+    using Bytes = std::shared_ptr<const std::string>;
+    // the bytes of key, or null if there are none
+    using Loader = std::function<Bytes(const std::string& key)>;
+
+    explicit ThumbnailByteCache(size_t capacity, size_t shard_count = 16);
+    ThumbnailByteCache(const ThumbnailByteCache&) = delete;
+    void operator=(const ThumbnailByteCache&) = delete;
+
+    // The bytes of every one of keys, in order. Each shard is locked once for the hits
+    // and once more for the misses, which are loaded in between without any lock held;
+    // a miss that load returns null for stays null and is not cached. Neither is a miss
+    // of a shard that put() or erase() changed while it was loading.
+    std::vector<Bytes> get(const std::vector<std::string>& keys, const Loader& load);
+
+    void put(const std::string& key, Bytes bytes);
+    void erase(const std::string& key);
+
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        size_t entries = 0;
+        size_t bytes = 0;
+    };
+    Stats stats() const;
+
+   private:
+    struct Entry {
+        std::string key;
+        Bytes bytes;
+    };
+
+    struct Shard {
+        mutable std::mutex mutex;
+        // most recently used first
+        std::list<Entry> lru;
+        std::unordered_map<std::string, std::list<Entry>::iterator> entries;
+        size_t bytes = 0;
+        // bumped by put() and erase()
+        uint64_t generation = 0;
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+    };
+
+    static size_t cost(const std::string& key, const Bytes& bytes);
+    Shard& shard_of(const std::string& key);
+    void put_locked(Shard& shard, const std::string& key, Bytes bytes);
+
+    const size_t shard_capacity;
+    std::vector<Shard> shards;
+};
@@ -347,7 +347,8 @@ IFEntry parseIFEntry_temp(const unsigned char *buf, const unsigned offs,
       }
       // and cut zero byte at the end, since we don't want that in the
       // std::string
-      if (result.val_string()[result.val_string().length() - 1] == '\0') {
+      if (result.val_string().length() &&
+          result.val_string()[result.val_string().length() - 1] == '\0') {
         result.val_string().resize(result.val_string().length() - 1);
       }
       break;
@@ -456,7 +457,15 @@ int easyexif::EXIFInfo::parseFrom(const unsigned char *buf, unsigned len) {
     return PARSE_EXIF_ERROR_CORRUPT;
   offs += 2;
 
-  return parseFromEXIFSegment(buf + offs, len - offs);
+  int ret = parseFromEXIFSegment(buf + offs, len - offs);
+  // the thumbnail has to be inside the APP1 segment
+  if (this->ThumbnailLength &&
+      this->ThumbnailOffset + this->ThumbnailLength > section_length - 2u) {
+    this->ThumbnailOffset = 0;
+    this->ThumbnailLength = 0;
+  }
+  if (this->ThumbnailLength) this->ThumbnailOffset += offs;
+  return ret;
 }
 
 int easyexif::EXIFInfo::parseFrom(const string &data) {
@@ -473,6 +482,8 @@ int easyexif::EXIFInfo::parseFrom(const string &data) {
 int easyexif::EXIFInfo::parseFromEXIFSegment(const unsigned char *buf,
                                              unsigned len) {
   bool alignIntel = true;  // byte alignment (defined in EXIF header)
+  this->ThumbnailOffset = 0;
+  this->ThumbnailLength = 0;
   unsigned offs = 0;       // current offset into buffer
   if (!buf || len < 6) return PARSE_EXIF_ERROR_NO_EXIF;
 
@@ -580,6 +591,14 @@ int easyexif::EXIFInfo::parseFromEXIFSegment(const unsigned char *buf,
     }
   }
 
+  // The 4 bytes after IFD0 are the offset to IFD1, which describes the
+  // thumbnail image. Only a JPEG thumbnail (JPEGInterchangeFormat and
+  // JPEGInterchangeFormatLength) is looked for; a corrupt IFD1 just means
+  // there is none.
+  unsigned ifd1_offset = parse_value<uint32_t>(buf + offs, alignIntel);
+  if (ifd1_offset) parseThumbnailIFD(buf, tiff_header_start + ifd1_offset,
+                                     tiff_header_start, len, alignIntel);
+
   // Jump to the EXIF SubIFD if it exists and parse all the information
   // there. Note that it's possible that the EXIF SubIFD doesn't exist.
   // The EXIF SubIFD contains most of the interesting information that a
@@ -857,6 +876,51 @@ int easyexif::EXIFInfo::parseFromEXIFSegment(const unsigned char *buf,
   return PARSE_EXIF_SUCCESS;
 }
 
+//
+// Finds the JPEG thumbnail in IFD1, which starts at 'offs'. It is kept only
+// if it lies within the buffer and starts with a JPEG SOI marker.
+//
+void easyexif::EXIFInfo::parseThumbnailIFD(const unsigned char *buf,
+                                           unsigned offs,
+                                           unsigned tiff_header_start,
+                                           unsigned len, bool alignIntel) {
+  if (offs < tiff_header_start || offs + 2 > len || offs + 2 < offs) return;
+  int num_entries = parse_value<uint16_t>(buf + offs, alignIntel);
+  if (offs + 2 + 12 * num_entries > len) return;
+  offs += 2;
+  unsigned thumbnail_offset = 0;
+  unsigned thumbnail_length = 0;
+  while (--num_entries >= 0) {
+    unsigned short tag, format;
+    unsigned length, data;
+    parseIFEntryHeader(buf + offs, alignIntel, tag, format, length, data);
+    offs += 12;
+    if (length != 1 || (format != 3 && format != 4)) continue;
+    // a short is left-aligned in the 4 bytes of the value
+    if (format == 3)
+      data = parse_value<uint16_t>(buf + offs - 4, alignIntel);
+    switch (tag) {
+      case 0x201:
+        // JPEGInterchangeFormat: offset of the thumbnail from the TIFF header
+        thumbnail_offset = data;
+        break;
+
+      case 0x202:
+        // JPEGInterchangeFormatLength
+        thumbnail_length = data;
+        break;
+    }
+  }
+
+  if (!thumbnail_offset || thumbnail_length < 4) return;
+  if (thumbnail_offset > len - tiff_header_start) return;
+  unsigned start = tiff_header_start + thumbnail_offset;
+  if (thumbnail_length > len - start) return;
+  if (buf[start] != 0xFF || buf[start + 1] != 0xD8) return;
+  this->ThumbnailOffset = start;
+  this->ThumbnailLength = thumbnail_length;
+}
+
 void easyexif::EXIFInfo::clear() {
   // Strings
   ImageDescription = "";
@@ -889,6 +953,8 @@ void easyexif::EXIFInfo::clear() {
   MeteringMode = 0;
   ImageWidth = 0;
   ImageHeight = 0;
+  ThumbnailOffset = 0;
+  ThumbnailLength = 0;
 
   // Geolocation
   GeoLocation.Latitude = 0;
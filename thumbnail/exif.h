@@ -116,6 +116,9 @@ class EXIFInfo {
                                     // 5: multi-segment
   unsigned ImageWidth;              // Image width reported in EXIF data
   unsigned ImageHeight;             // Image height reported in EXIF data
+  unsigned ThumbnailOffset;         // Offset of the JPEG thumbnail in IFD1 from the start
+                                    // of the buffer parsed, 0 if there is none
+  unsigned ThumbnailLength;         // Length of that thumbnail, 0 if there is none
   struct Geolocation_t {            // GPS information embedded in file
     double Latitude;                  // Image latitude expressed as decimal
     double Longitude;                 // Image longitude expressed as decimal
@@ -150,6 +153,11 @@ class EXIFInfo {
   EXIFInfo() {
     clear();
   }
+
+ private:
+  void parseThumbnailIFD(const unsigned char *buf, unsigned offs,
+                         unsigned tiff_header_start, unsigned len,
+                         bool alignIntel);
 };
 
 }
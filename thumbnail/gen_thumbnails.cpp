@@ -8,11 +8,26 @@
 #include <boost/gil.hpp>
 #include <boost/gil/extension/io/jpeg.hpp>
 #include <boost/gil/extension/io/png.hpp>
-#include <boost/gil/extension/numeric/resample.hpp>
-#include <boost/gil/extension/numeric/sampler.hpp>
+#include <ThreadPool/ThreadPool.h>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <istream>
+#include <memory>
 #include <sstream>
+#include <stdexcept>
 
-#include "./utils.h"
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "exif.h"
+#include "mapped_fd.h"
+#include "png_rows.h"
+#include "resample.h"
+#include "scaled_jpeg.h"
+#include "thumbnail_cache.h"
 
 using namespace boost::gil;
 using boost::filesystem::path;
@@ -62,58 +77,375 @@ inline std::pair<int, int> get_proper_thumbnail_size(ThumbnailType type, int wid
     }
 }
 
-std::optional<Thumbnail> gen_thumbnails(int type, const std::string& in_path_str,
-                                        const std::string& out_dir) {
-    try {
-        rgba8_image_t img;
-        std::string ext = boost::algorithm::to_lower_copy(path(in_path_str).extension().string());
+inline int get_thumbnail_standard(ThumbnailType type) {
+    switch (type) {
+        case ThumbnailType::Small:
+            return SmallThumbnailWidth;
 
-        if (ext == ".jpg" || ext == ".jpeg") {
-            boost::gil::read_and_convert_image(in_path_str, img, boost::gil::jpeg_tag{});
-        } else if (ext == ".png") {
-            boost::gil::read_and_convert_image(in_path_str, img, boost::gil::png_tag{});
+        case ThumbnailType::Medium:
+            return MediumThumbnailWidth;
+
+        case ThumbnailType::Large:
+            return LargeThumbnailWidth;
+
+        default:
+            return -1;
+    }
+}
+
+template <typename FormatTag>
+inline void read_source_image(const std::string& in_path_str, std::string_view src_bytes,
+                              rgba8_image_t& img, FormatTag tag) {
+    if (src_bytes.empty()) {
+        boost::gil::read_and_convert_image(in_path_str, img, tag);
+        return;
+    }
+
+    EasyIpc::MemoryStreamBuf buf(src_bytes);
+    std::istream in(&buf);
+    boost::gil::read_and_convert_image(in, img, tag);
+}
+
+// The size of the largest of levels (largest first) that is smaller than the source,
+// {-1, -1} when none is.
+static std::pair<int, int> largest_thumbnail_size(const std::vector<ThumbnailType>& levels,
+                                                  int width, int height) {
+    for (ThumbnailType type : levels) {
+        auto proper_size = get_proper_thumbnail_size(type, width, height);
+        if (proper_size.first >= 0) {
+            return proper_size;
+        }
+    }
+    return {-1, -1};
+}
+
+// Resamples src into every one of levels (largest first) with filter, in strips on
+// pool when given, and passes each to encode.
+// Sizes are computed from width and height, the dimensions of the source before any
+// decode-time scaling, so that they depend neither on the scale nor on which others
+// were requested; the pixels come from the previous level, a few times smaller than
+// the source, so each resample reads little more than it writes.
+template <typename SrcView, typename Encode>
+static void resample_levels(const SrcView& src, int width, int height,
+                            const std::vector<ThumbnailType>& levels, ResampleFilter filter,
+                            ThreadPool* pool, Encode&& encode) {
+    ThumbnailImage previous;
+    for (ThumbnailType type : levels) {
+        auto proper_size = get_proper_thumbnail_size(type, width, height);
+        if (proper_size.first < 0) {
+            continue;
+        }
+
+        auto thumbnail_img = std::make_shared<rgb8_image_t>(proper_size.first, proper_size.second);
+        if (previous) {
+            resample_view(const_view(*previous), view(*thumbnail_img), filter, pool);
+        } else {
+            resample_view(src, view(*thumbnail_img), filter, pool);
+        }
+        encode(type, thumbnail_img);
+        previous = std::move(thumbnail_img);
+    }
+}
+
+// Resamples the rows of a decoder straight into the largest of levels that is smaller
+// than the source, so that the decoded source is never held whole.
+class LevelSink final : public RowSink {
+   public:
+    LevelSink(const std::vector<ThumbnailType>& levels, ResampleFilter filter)
+        : levels(levels), filter(filter) {}
+
+    void start(int source_width, int source_height, int row_width, int rows,
+               int channels) override {
+        width = source_width;
+        height = source_height;
+        rgba = channels == 4;
+        for (ThumbnailType type : levels) {
+            auto proper_size = get_proper_thumbnail_size(type, width, height);
+            if (proper_size.first < 0) {
+                continue;
+            }
+            level = type;
+            image = std::make_shared<rgb8_image_t>(proper_size.first, proper_size.second);
+            resampler = std::make_unique<RowResampler>(row_width, rows, view(*image), filter);
+            return;
+        }
+    }
+
+    void row(const uint8_t* pixels) override {
+        if (resampler == nullptr) {
+            return;
+        }
+        if (rgba) {
+            resampler->push_rgba(pixels);
         } else {
+            resampler->push_rgb(pixels);
+        }
+    }
+
+    const std::vector<ThumbnailType>& levels;
+    const ResampleFilter filter;
+    // the source's dimensions
+    int width = 0;
+    int height = 0;
+    bool rgba = false;
+    // the level being produced, image is null if none is smaller than the source
+    ThumbnailType level = ThumbnailType::Small;
+    std::shared_ptr<rgb8_image_t> image;
+    std::unique_ptr<RowResampler> resampler;
+};
+
+void read_file(const std::string& path, std::string& bytes) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        throw std::runtime_error("cannot open " + path);
+    }
+    bytes.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(&bytes[0], static_cast<std::streamsize>(bytes.size()));
+}
+
+// libjpeg and libpng decode from memory. A source given by path is mapped, so that
+// its pages can be dropped again under memory pressure, or else read in.
+static std::string_view read_source_bytes(const std::string& in_path_str,
+                                          std::string_view src_bytes, EasyIpc::MappedFd& mapped,
+                                          std::string& file_bytes) {
+    if (!src_bytes.empty()) {
+        return src_bytes;
+    }
+#ifndef _WIN32
+    int fd = ::open(in_path_str.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd >= 0) {
+        bool ok = mapped.Map(fd);
+        ::close(fd);
+        if (ok) {
+            return mapped.bytes();
+        }
+    }
+#endif
+    read_file(in_path_str, file_bytes);
+    return file_bytes;
+}
+
+static std::string lower_extension(const std::string& src_path) {
+    return boost::algorithm::to_lower_copy(path(src_path).extension().string());
+}
+
+bool has_thumbnail_format(const std::string& src_path) {
+    std::string ext = lower_extension(src_path);
+    return ext == ".jpg" || ext == ".jpeg" || ext == ".png";
+}
+
+std::vector<ThumbnailType> thumbnail_levels(const std::vector<int>& types) {
+    std::vector<ThumbnailType> levels;
+    for (int type : types) {
+        auto level = static_cast<ThumbnailType>(type);
+        if (get_thumbnail_standard(level) > 0 &&
+            std::find(levels.begin(), levels.end(), level) == levels.end()) {
+            levels.push_back(level);
+        }
+    }
+    std::sort(levels.begin(), levels.end(), [](ThumbnailType a, ThumbnailType b) {
+        return get_thumbnail_standard(a) > get_thumbnail_standard(b);
+    });
+    return levels;
+}
+
+bool decode_source(const std::string& src_path, std::string_view src_bytes,
+                   const std::vector<ThumbnailType>& levels, ResampleFilter filter,
+                   DecodedSource& source) {
+    std::string ext = lower_extension(src_path);
+    bool jpeg = ext == ".jpg" || ext == ".jpeg";
+    if (!jpeg && ext != ".png") {
+        return false;
+    }
+    // JPEGs are decoded at 1/2, 1/4 or 1/8 of the size when the largest level allows it
+    auto target = [&levels](int w, int h) { return largest_thumbnail_size(levels, w, h); };
+
+    // Streamed, the decoder's rows go straight into the largest level and the other
+    // levels come from it. gil's bilinear_sampler needs the whole image, as do CMYK
+    // JPEGs and interlaced PNGs.
+    if (filter != ResampleFilter::Bilinear) {
+        LevelSink sink(levels, filter);
+        if (jpeg ? read_scaled_jpeg_rows(src_bytes, target, sink)
+                 : read_png_rows(src_bytes, sink)) {
+            source.width = sink.width;
+            source.height = sink.height;
+            if (sink.image != nullptr) {
+                source.streamed.emplace(sink.level, std::move(sink.image));
+            }
+            return true;
+        }
+    }
+
+    if (jpeg && read_scaled_jpeg(src_bytes, target, source.rgb, source.width, source.height)) {
+        return true;
+    }
+    if (jpeg) {
+        read_source_image(src_path, src_bytes, source.rgba, boost::gil::jpeg_tag{});
+    } else {
+        read_source_image(src_path, src_bytes, source.rgba, boost::gil::png_tag{});
+    }
+    source.width = static_cast<int>(source.rgba.width());
+    source.height = static_cast<int>(source.rgba.height());
+    return true;
+}
+
+void resample_source(const DecodedSource& source, const std::vector<ThumbnailType>& levels,
+                     ResampleFilter filter, ThreadPool* pool,
+                     const std::function<void(ThumbnailType, ThumbnailImage)>& encode) {
+    if (source.streamed.has_value()) {
+        auto [level, image] = *source.streamed;
+        encode(level, image);
+        auto next = std::next(std::find(levels.begin(), levels.end(), level));
+        std::vector<ThumbnailType> smaller(next, levels.end());
+        resample_levels(const_view(*image), source.width, source.height, smaller, filter, pool,
+                        encode);
+    } else if (source.rgb.width() > 0) {
+        resample_levels(const_view(source.rgb), source.width, source.height, levels, filter,
+                        pool, encode);
+    } else if (source.rgba.width() > 0) {
+        resample_levels(const_view(source.rgba), source.width, source.height, levels, filter,
+                        pool, encode);
+    }
+}
+
+std::string thumbnail_image_id(const std::string& source_key, const std::string& src_path,
+                               ResampleFilter filter) {
+    return ThumbnailCache::image_id(source_key, resample_filter_name(filter),
+                                    lower_extension(src_path));
+}
+
+std::vector<Thumbnail> take_cached_levels(ThumbnailCache& cache, const std::string& image_id,
+                                          std::vector<ThumbnailType>& levels) {
+    std::vector<Thumbnail> cached;
+    auto missing = levels.begin();
+    for (ThumbnailType type : levels) {
+        if (auto thumbnail = cache.find(image_id, type)) {
+            cached.push_back(std::move(*thumbnail));
+        } else {
+            *missing++ = type;
+        }
+    }
+    levels.erase(missing, levels.end());
+    return cached;
+}
+
+std::optional<Thumbnail> take_embedded_small(ThumbnailCache& cache, const std::string& image_id,
+                                             std::string_view src_bytes, ResampleFilter filter,
+                                             std::vector<ThumbnailType>& levels) {
+    auto small = std::find(levels.begin(), levels.end(), ThumbnailType::Small);
+    std::string ext = lower_extension(image_id);
+    if (small == levels.end() || (ext != ".jpg" && ext != ".jpeg")) {
+        return std::nullopt;
+    }
+
+    rgb8_image_t img;
+    try {
+        easyexif::EXIFInfo exif;
+        if (exif.parseFrom(reinterpret_cast<const unsigned char*>(src_bytes.data()),
+                           static_cast<unsigned>(src_bytes.size())) != PARSE_EXIF_SUCCESS ||
+            exif.ThumbnailLength == 0) {
             return std::nullopt;
         }
+        std::string_view preview = src_bytes.substr(exif.ThumbnailOffset, exif.ThumbnailLength);
 
-        auto proper_size =
-            get_proper_thumbnail_size(static_cast<ThumbnailType>(type), img.width(), img.height());
+        int width, height;
+        read_jpeg_size(src_bytes, width, height);
+        auto proper_size = get_proper_thumbnail_size(ThumbnailType::Small, width, height);
+        // no Small for a source smaller than it
         if (proper_size.first < 0) {
             return std::nullopt;
         }
 
-        rgb8_image_t thumbnail_img(proper_size.first, proper_size.second);
-        resize_view(const_view(img), view(thumbnail_img), bilinear_sampler{});
-
-        path src_path(in_path_str);
-        std::string filename = src_path.filename().string();
-        std::string no_ext = src_path.stem().string();
-
-        std::cout << filename << " " << no_ext << " " << ext << std::endl;
+        rgb8_image_t decoded;
+        int preview_width, preview_height;
+        auto target = [&proper_size](int, int) { return proper_size; };
+        if (!read_scaled_jpeg(preview, target, decoded, preview_width, preview_height)) {
+            return std::nullopt;
+        }
+        // Many cameras pad the preview to 160x120 whatever the sensor's aspect ratio;
+        // one that does not match the source within a pixel of Small is not used.
+        double aspect = static_cast<double>(width) / height;
+        double preview_aspect = static_cast<double>(preview_width) / preview_height;
+        if (preview_width < proper_size.first || preview_height < proper_size.second ||
+            std::abs(preview_aspect - aspect) * SmallThumbnailWidth > aspect) {
+            return std::nullopt;
+        }
 
-        std::stringstream gen_filename_ss;
+        img.recreate(proper_size.first, proper_size.second);
+        resample_view(const_view(decoded), view(img), filter);
+    } catch (std::exception& ex) {
+        return std::nullopt;
+    }
 
-        gen_filename_ss << src_path.stem().string() << "-" << GenRandomString(6) << "-"
-                        << ThumbnailType_Name(type) << src_path.extension().string();
+    auto thumbnail = write_thumbnail(cache, image_id, ThumbnailType::Small, img);
+    if (thumbnail.has_value()) {
+        levels.erase(small);
+    }
+    return thumbnail;
+}
 
-        path output_path = path(out_dir) / path(gen_filename_ss.str());
-        std::string output_path_str = output_path.string();
-        std::cout << "prepare to gen image: " << output_path.string() << std::endl;
+std::optional<Thumbnail> write_thumbnail(ThumbnailCache& cache, const std::string& image_id,
+                                         ThumbnailType type, const rgb8_image_t& img) {
+    try {
+        std::cout << "prepare to gen image: " << image_id << " " << ThumbnailType_Name(type)
+                  << std::endl;
+        std::ostringstream encoded;
+        std::string ext = lower_extension(image_id);
         if (ext == ".jpg" || ext == ".jpeg") {
-            write_view(output_path_str, const_view(thumbnail_img), jpeg_tag{});
+            write_view(encoded, const_view(img), jpeg_tag{});
         } else {
-            write_view(output_path_str, const_view(thumbnail_img), png_tag{});
+            write_view(encoded, const_view(img), png_tag{});
         }
+        auto thumbnail = cache.put(image_id, type, static_cast<int>(img.width()),
+                                   static_cast<int>(img.height()), encoded.str());
         std::cout << "finished" << std::endl;
-
-        Thumbnail tb;
-        tb.set_width(proper_size.first);
-        tb.set_height(proper_size.second);
-        tb.set_path(output_path_str);
-        tb.set_type(static_cast<ThumbnailType>(type));
-        return {tb};
+        return thumbnail;
     } catch (std::exception& ex) {
         std::cerr << ex.what() << std::endl;
         return std::nullopt;
     }
 }
+
+void gen_thumbnails(const std::vector<int>& types, const std::string& in_path_str,
+                    const std::string& out_dir, std::string_view src_bytes,
+                    ResampleFilter filter, ThreadPool& pool, const ThumbnailCallback& on_ready) {
+    std::vector<ThumbnailType> levels = thumbnail_levels(types);
+    ThumbnailCache& cache = ThumbnailCache::for_dir(out_dir);
+    std::string image_id;
+    std::vector<Future<void>> encodes;
+    auto encode = [&](ThumbnailType type, ThumbnailImage thumbnail_img) {
+        encodes.push_back(pool.async([=, &cache, &on_ready] {
+            // a failed encode only loses its own size
+            if (auto ret = write_thumbnail(cache, image_id, type, *thumbnail_img);
+                ret.has_value()) {
+                on_ready(*ret);
+            }
+        }));
+    };
+
+    try {
+        EasyIpc::MappedFd mapped;
+        std::string file_bytes;
+        DecodedSource source;
+        if (has_thumbnail_format(in_path_str)) {
+            std::string_view bytes =
+                read_source_bytes(in_path_str, src_bytes, mapped, file_bytes);
+            image_id = thumbnail_image_id(ThumbnailCache::source_key(bytes), in_path_str, filter);
+            for (const Thumbnail& thumbnail : take_cached_levels(cache, image_id, levels)) {
+                on_ready(thumbnail);
+            }
+            if (auto small = take_embedded_small(cache, image_id, bytes, filter, levels)) {
+                on_ready(*small);
+            }
+            if (!levels.empty() && decode_source(in_path_str, bytes, levels, filter, source)) {
+                resample_source(source, levels, filter, &pool, encode);
+            }
+        }
+    } catch (std::exception& ex) {
+        std::cerr << ex.what() << std::endl;
+    }
+
+    // a worker waiting here runs queued tasks, the encodes among them
+    when_all(std::move(encodes)).get();
+}
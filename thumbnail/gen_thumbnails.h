@@ -6,8 +6,103 @@
 
 #include <ipc-message/ipc.pb.h>
 
+#include <functional>
+#include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
-std::optional<proto::Thumbnail> gen_thumbnails(int type, const std::string& src_path,
-                                               const std::string& out_path);
+#include "resample.h"
+
+class ThreadPool;
+class ThumbnailCache;
+
+using ThumbnailCallback = std::function<void(const proto::Thumbnail&)>;
+
+// Decodes the source once and produces every size in types that is smaller than the
+// source, Large from the decoded image, then Medium from Large and Small from Medium,
+// each resampled with filter in strips on pool. Unless filter is Bilinear, the decoded
+// rows go into the largest size as they come, so that the source is never held whole.
+// The encodes run on pool while the next size is resampled, on_ready is called there
+// as each file is written; returns when all are.
+// Thumbnails are named after the content of the source (ThumbnailCache), the sizes
+// already in out_path's cache are passed to on_ready right away and not made again;
+// the source is not decoded at all when all of them are.
+// Small is made of the source's embedded EXIF preview when it has a usable one, and
+// passed to on_ready before the source is decoded (take_embedded_small).
+// If src_bytes is not empty the source is decoded from it (e.g. a mapped fd attached
+// to the request) instead of being read from src_path, which then only provides
+// the format and the output name.
+void gen_thumbnails(const std::vector<int>& types, const std::string& src_path,
+                    const std::string& out_path, std::string_view src_bytes,
+                    ResampleFilter filter, ThreadPool& pool, const ThumbnailCallback& on_ready);
+
+// The steps of gen_thumbnails, for callers that run them on stages of their own
+// (ThumbnailPipeline).
+
+// The sizes in types, largest first, each once.
+std::vector<proto::ThumbnailType> thumbnail_levels(const std::vector<int>& types);
+
+using ThumbnailImage = std::shared_ptr<const boost::gil::rgb8_image_t>;
+
+// A source decoded for a set of levels.
+struct DecodedSource {
+    // the source's dimensions before any decode-time scaling
+    int width = 0;
+    int height = 0;
+    // the largest level, when it was resampled from the rows as they were decoded
+    std::optional<std::pair<proto::ThumbnailType, ThumbnailImage>> streamed;
+    // otherwise the decoded image, at most one of them
+    boost::gil::rgb8_image_t rgb;
+    boost::gil::rgba8_image_t rgba;
+};
+
+// a JPEG or PNG by its extension, the formats thumbnails are made of
+bool has_thumbnail_format(const std::string& src_path);
+
+// Reads the whole file at path into bytes. Throws if it cannot be opened.
+void read_file(const std::string& path, std::string& bytes);
+
+// Decodes src_bytes, a JPEG or PNG as told by src_path's extension, for levels (largest
+// first). false for other formats; throws if the source cannot be decoded.
+bool decode_source(const std::string& src_path, std::string_view src_bytes,
+                   const std::vector<proto::ThumbnailType>& levels, ResampleFilter filter,
+                   DecodedSource& source);
+
+// Passes every one of levels that is smaller than the source to encode, largest
+// first: the streamed one as is, the others each resampled from the previous one,
+// in strips on pool when given.
+void resample_source(const DecodedSource& source,
+                     const std::vector<proto::ThumbnailType>& levels, ResampleFilter filter,
+                     ThreadPool* pool,
+                     const std::function<void(proto::ThumbnailType, ThumbnailImage)>& encode);
+
+// The image id the thumbnails of a source made with filter are stored under in a
+// ThumbnailCache.
+std::string thumbnail_image_id(const std::string& source_key, const std::string& src_path,
+                               ResampleFilter filter);
+
+// Removes the levels that cache holds a thumbnail of already from levels and returns
+// those thumbnails.
+std::vector<proto::Thumbnail> take_cached_levels(ThumbnailCache& cache,
+                                                 const std::string& image_id,
+                                                 std::vector<proto::ThumbnailType>& levels);
+
+// Makes the Small thumbnail of a JPEG source from the preview embedded in its EXIF
+// data (IFD1) instead of from the source, and removes Small from levels. nullopt,
+// levels untouched, unless Small is in levels and the preview decodes, covers the
+// Small size and has the source's aspect ratio (not letterboxed).
+std::optional<proto::Thumbnail> take_embedded_small(ThumbnailCache& cache,
+                                                    const std::string& image_id,
+                                                    std::string_view src_bytes,
+                                                    ResampleFilter filter,
+                                                    std::vector<proto::ThumbnailType>& levels);
+
+// Encodes img in the format of image_id's extension and puts it in cache. nullopt if
+// it fails.
+std::optional<proto::Thumbnail> write_thumbnail(ThumbnailCache& cache,
+                                                const std::string& image_id,
+                                                proto::ThumbnailType type,
+                                                const boost::gil::rgb8_image_t& img);
@@ -1,28 +1,189 @@
 #include <ThreadPool/ThreadPool.h>
 
+#include <boost/filesystem.hpp>
+
 #include <algorithm>
 #include <iostream>
+#include <unordered_map>
 
+#include "byte_cache.h"
 #include "easyipc.h"
 #include "gen_thumbnails.h"
+#include "handler_registry.h"
+#include "mapped_fd.h"
 #include "ipc-message/ipc.pb.h"
 #include "read_exif.h"
+#include "thumbnail_cache.h"
+#include "thumbnail_pipeline.h"
 
 using EasyIpc::IpcServer;
+using EasyIpc::MappedFd;
+using proto::GenerateThumbnailsBatchRequest;
+using proto::GenerateThumbnailsBatchResponse;
 using proto::GenerateThumbnailsRequest;
 using proto::GenerateThumbnailsResponse;
+using proto::GetThumbnailBytesRequest;
+using proto::GetThumbnailBytesResponse;
 using proto::MessageType;
 using proto::MessageType_Name;
+using proto::ExifInfo;
 using proto::ReadExifRequest;
+using proto::RemoveThumbnailsRequest;
+using proto::RemoveThumbnailsResponse;
 
 static std::string server_handler(EasyIpc::Context& ctx, const EasyIpc::Message& msg);
-static std::string gen_thumbnails(const GenerateThumbnailsRequest& req);
+static void gen_thumbnails(EasyIpc::Context& ctx, const GenerateThumbnailsRequest& req,
+                           std::shared_ptr<MappedFd> source);
+static std::shared_ptr<MappedFd> map_source_fd(const EasyIpc::Message& msg);
+static ThumbnailPipeline& batch_pipeline();
+static void get_thumbnail_bytes(const GetThumbnailBytesRequest& req,
+                                GetThumbnailBytesResponse& resp);
+static void remove_thumbnails(const RemoveThumbnailsRequest& req, RemoveThumbnailsResponse& resp);
+static void forget_thumbnail_bytes(const ThumbnailCache& cache, const proto::Thumbnail& thumbnail);
 static ThreadPool* thread_pool;
+static ResampleFilter resample_filter = ResampleFilter::Triangle;
+static PipelineConfig pipeline_config;
+static size_t thumbnail_memory_mb = 256;
+static std::unique_ptr<ThumbnailByteCache> byte_cache;
+static EasyIpc::HandlerRegistry handlers;
 
-int main() {
-    thread_pool = &ThreadPool::GlobalPool();
+// --pools=SPEC sizes and pins the named pools, see ThreadPool::ConfigureFromSpec.
+// --instrument-pools records their queueing and run times, served with the metrics.
+// --resample-filter=bilinear|box|triangle|lanczos3 shrinks the thumbnails with it,
+// triangle by default: as fast as bilinear once decoded at scale, without its aliasing,
+// and streamed like the other kernels instead of holding the whole decoded source.
+// --batch-stages=read=N,decode=N,resize=N,write=N sizes the stages of batch requests.
+// --pack-thumbnails stores the thumbnails in packfiles (ThumbnailStore) instead of a
+// file each. Packed thumbnails have no path: only for clients that read them by image
+// id with GetThumbnailBytes.
+// --thumbnail-memory-mb=N bounds the thumbnails GetThumbnailBytes keeps in memory.
+static bool configure(int argc, char* argv[], bool& instrument, bool& pack) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        std::string spec;
+        if (arg == "--instrument-pools") {
+            instrument = true;
+            continue;
+        } else if (arg == "--pack-thumbnails") {
+            pack = true;
+            continue;
+        } else if (arg.compare(0, 22, "--thumbnail-memory-mb=") == 0) {
+            thumbnail_memory_mb = std::strtoul(arg.c_str() + 22, nullptr, 10);
+            continue;
+        } else if (arg.compare(0, 18, "--resample-filter=") == 0) {
+            if (!parse_resample_filter(arg.substr(18), resample_filter)) {
+                std::cerr << "invalid --resample-filter: " << arg.substr(18) << std::endl;
+                return false;
+            }
+            continue;
+        } else if (arg.compare(0, 15, "--batch-stages=") == 0) {
+            if (!parse_pipeline_config(arg.substr(15), pipeline_config)) {
+                std::cerr << "invalid --batch-stages: " << arg.substr(15) << std::endl;
+                return false;
+            }
+            continue;
+        } else if (arg.compare(0, 8, "--pools=") == 0) {
+            spec = arg.substr(8);
+        } else if (arg == "--pools" && i + 1 < argc) {
+            spec = argv[++i];
+        } else {
+            continue;
+        }
+        std::string error;
+        if (!ThreadPool::ConfigureFromSpec(spec, &error)) {
+            std::cerr << "invalid --pools: " << error << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    bool instrument_pools = false;
+    bool pack_thumbnails = false;
+    if (!configure(argc, argv, instrument_pools, pack_thumbnails)) {
+        return 1;
+    }
+    if (pack_thumbnails) {
+        ThumbnailCache::pack_into_stores(ThreadPool::Named(ThreadPool::kBackgroundPool));
+    }
+    // decoding and resizing run on their own pool, so that a bulk import cannot hold
+    // the workers that accept connections and answer exif reads
+    thread_pool = &ThreadPool::Named(ThreadPool::kDecodePool);
+    ThreadPool& io_pool = ThreadPool::Named(ThreadPool::kIoPool);
+    if (instrument_pools) {
+        thread_pool->enable_instrumentation();
+        io_pool.enable_instrumentation();
+    }
+
+    handlers.Register<GenerateThumbnailsRequest, GenerateThumbnailsResponse>(
+        MessageType::GenerateThumbnails,
+        [](EasyIpc::Context& ctx, const EasyIpc::Message& msg, const GenerateThumbnailsRequest& req,
+           GenerateThumbnailsResponse& resp) {
+            gen_thumbnails(ctx, req, map_source_fd(msg));
+            return true;
+        });
+
+    // A batch occupies one decode worker while it waits; the work itself runs on the
+    // pipeline's own stages, started by the first batch. Batches have a class of their
+    // own that runs one at a time, the other workers stay with single requests.
+    handlers.Register<GenerateThumbnailsBatchRequest, GenerateThumbnailsBatchResponse>(
+        MessageType::GenerateThumbnailsBatch,
+        [](EasyIpc::Context& ctx, const EasyIpc::Message& msg,
+           const GenerateThumbnailsBatchRequest& req, GenerateThumbnailsBatchResponse& resp) {
+            // every source is written as a partial response as soon as it is done
+            batch_pipeline().run(req, [&ctx](const proto::ThumbnailBatchResult& result) {
+                GenerateThumbnailsBatchResponse partial;
+                partial.add_results()->CopyFrom(result);
+                ctx.Write(partial.SerializeAsString());
+            });
+            return true;
+        });
+
+    // the grid's thumbnails, answered on the io pool like other interactive requests
+    byte_cache = std::make_unique<ThumbnailByteCache>(thumbnail_memory_mb << 20);
+    ThumbnailCache::on_change(forget_thumbnail_bytes);
+    handlers.Register<GetThumbnailBytesRequest, GetThumbnailBytesResponse>(
+        MessageType::GetThumbnailBytes,
+        [](EasyIpc::Context& ctx, const EasyIpc::Message& msg, const GetThumbnailBytesRequest& req,
+           GetThumbnailBytesResponse& resp) {
+            get_thumbnail_bytes(req, resp);
+            return true;
+        });
+
+    handlers.Register<RemoveThumbnailsRequest, RemoveThumbnailsResponse>(
+        MessageType::RemoveThumbnails,
+        [](EasyIpc::Context& ctx, const EasyIpc::Message& msg, const RemoveThumbnailsRequest& req,
+           RemoveThumbnailsResponse& resp) {
+            remove_thumbnails(req, resp);
+            return true;
+        });
+
+    handlers.Register<ReadExifRequest, ExifInfo>(
+        MessageType::ReadExif, [](EasyIpc::Context& ctx, const EasyIpc::Message& msg,
+                                  const ReadExifRequest& req, ExifInfo& resp) {
+            auto source = map_source_fd(msg);
+            auto opt = read_exif(req.path(), source ? source->bytes() : std::string_view());
+            if (opt == std::nullopt) {
+                return false;
+            }
+            resp = std::move(*opt);
+            return true;
+        });
 
     auto server = std::make_shared<IpcServer>("thumbnail-service");
+    server->serve_mode = EasyIpc::ServeMode::Reactor;
+    server->thread_pool = &io_pool;
+    // exif reads and callers that ask for the interactive class
+    // (IpcClient::SetPriority(0)) stay on the io pool, thumbnails go to the decode pool,
+    // batches after single thumbnails and never more than one of them at once
+    server->priority_classes = {
+        EasyIpc::PriorityClass{},
+        EasyIpc::PriorityClass{0, 4096, thread_pool},
+        EasyIpc::PriorityClass{1, 64, thread_pool},
+    };
+    server->message_type_priority = {{MessageType::GenerateThumbnails, 1},
+                                      {MessageType::GenerateThumbnailsBatch, 2}};
     server->message_handler = server_handler;
     server->Run();
     return 0;
@@ -30,70 +191,125 @@ int main() {
 
 std::string server_handler(EasyIpc::Context& ctx, const EasyIpc::Message& msg) {
     std::cout << "receive message: " << MessageType_Name(msg.message_type) << std::endl;
-    switch (msg.message_type) {
-        case MessageType::GenerateThumbnails: {
-            GenerateThumbnailsRequest request;
-            if (!request.ParseFromString(msg.content)) {
-                return "";
-            }
+    return handlers.Dispatch(ctx, msg);
+}
 
-            return gen_thumbnails(request);
-        }
+// The stages' threads are only started once a batch arrives.
+static ThumbnailPipeline& batch_pipeline() {
+    static ThumbnailPipeline pipeline(pipeline_config, resample_filter);
+    return pipeline;
+}
 
-        case MessageType::ReadExif: {
-            ReadExifRequest request;
-            if (!request.ParseFromString(msg.content)) {
-                return "";
-            }
+// A caller that already opened the source may attach its descriptor to the request,
+// the file is then mapped once instead of being re-opened and re-read by every task.
+std::shared_ptr<MappedFd> map_source_fd(const EasyIpc::Message& msg) {
+    if (msg.fds.empty()) {
+        return nullptr;
+    }
 
-            if (auto opt = read_exif(request.path()); opt != std::nullopt) {
-                return opt->SerializeAsString();
-            }
+    auto source = std::make_shared<MappedFd>();
+    if (!source->Map(msg.fds[0])) {
+        return nullptr;
+    }
+    return source;
+}
 
-            return "";
-        }
+// Every thumbnail is written as a partial GenerateThumbnailsResponse as soon as it is
+// ready. Clients that do not read a stream get the concatenation, which parses as
+// one response holding all of them.
+static void gen_thumbnails(EasyIpc::Context& ctx, const GenerateThumbnailsRequest& req,
+                           std::shared_ptr<MappedFd> source) {
+    std::string_view src_bytes = source ? source->bytes() : std::string_view();
+    std::vector<int> types(req.types().begin(), req.types().end());
 
-        default:
-            return "";
-    }
+    // one decode for all the sizes, their encodes run in parallel
+    gen_thumbnails(types, req.path(), req.out_dir(), src_bytes, resample_filter, *thread_pool,
+                   [&ctx](const proto::Thumbnail& thumbnail) {
+                       GenerateThumbnailsResponse partial;
+                       partial.add_data()->CopyFrom(thumbnail);
+                       ctx.Write(partial.SerializeAsString());
+                   });
 }
 
-template <typename T>
-class plus_when_dtor {
-   public:
-    plus_when_dtor(T& ref, std::condition_variable& cv) : ref_(ref), cv_(cv) {}
+// The byte cache keys of a thumbnail, by image id and by its resolved path.
+static std::string byte_cache_key(const ThumbnailCache& cache, const std::string& image_id,
+                                  proto::ThumbnailType type) {
+    return "id:" + cache.dir() + "/" + image_id + "/" + proto::ThumbnailType_Name(type);
+}
 
-    ~plus_when_dtor() {
-        ref_++;
-        cv_.notify_one();
-    }
+static std::string byte_cache_key(const std::string& resolved_path) {
+    return "path:" + resolved_path;
+}
 
-   private:
-    std::condition_variable& cv_;
-    T& ref_;
-};
+// A thumbnail written again or removed must not be served from the copy read before.
+// Its file may be gone, the key is that of its resolved directory and its name.
+static void forget_thumbnail_bytes(const ThumbnailCache& cache, const proto::Thumbnail& thumbnail) {
+    byte_cache->erase(byte_cache_key(cache, thumbnail.image_id(), thumbnail.type()));
+    if (!thumbnail.path().empty()) {
+        boost::filesystem::path path(thumbnail.path());
+        boost::system::error_code ec;
+        auto dir = boost::filesystem::canonical(path.parent_path(), ec);
+        if (!ec) {
+            byte_cache->erase(byte_cache_key((dir / path.filename()).string()));
+        }
+    }
+}
 
-static std::string gen_thumbnails(const GenerateThumbnailsRequest& req) {
-    GenerateThumbnailsResponse resp;
-    std::mutex resp_mutex;
-    std::condition_variable resp_cv;
-    int finished_count = 0;
+// Thumbnails are looked up by out_dir and image id, or by path. Either is served only
+// from an out_dir thumbnails were written to (ThumbnailCache::existing), and a path
+// only if it resolves to one of the files in that cache's index, so that the request
+// cannot read arbitrary files.
+static void get_thumbnail_bytes(const GetThumbnailBytesRequest& req,
+                                GetThumbnailBytesResponse& resp) {
+    ThumbnailCache* cache = ThumbnailCache::existing(req.out_dir());
+    std::vector<std::string> keys;
+    std::unordered_map<std::string, const proto::ThumbnailRef*> refs;
+    for (const proto::ThumbnailRef& ref : req.thumbnails()) {
+        std::string key;
+        if (cache != nullptr && !ref.image_id().empty()) {
+            key = byte_cache_key(*cache, ref.image_id(), ref.type());
+        } else if (cache != nullptr) {
+            auto path = cache->resolve(ref.path());
+            key = path ? byte_cache_key(*path) : std::string();
+        }
+        refs.emplace(key, &ref);
+        keys.push_back(std::move(key));
+    }
 
-    for (auto type : req.types()) {
-        thread_pool->add_task([type, req, &finished_count, &resp, &resp_mutex, &resp_cv] {
-            plus_when_dtor<int> id(finished_count, resp_cv);
+    auto load = [&](const std::string& key) -> ThumbnailByteCache::Bytes {
+        if (key.empty()) {
+            return nullptr;
+        }
+        const proto::ThumbnailRef& ref = *refs[key];
+        if (!ref.image_id().empty()) {
+            auto bytes = cache->read(ref.image_id(), ref.type());
+            return bytes ? std::make_shared<const std::string>(std::move(*bytes)) : nullptr;
+        }
 
-            if (auto ret = gen_thumbnails(type, req.path(), req.out_dir()); ret.has_value()) {
-                std::lock_guard<std::mutex> guard(resp_mutex);
+        std::string bytes;
+        try {
+            read_file(key.substr(key.find(':') + 1), bytes);
+        } catch (std::exception& ex) {
+            return nullptr;
+        }
+        return std::make_shared<const std::string>(std::move(bytes));
+    };
 
-                auto thumbnail = resp.add_data();
-                thumbnail->CopyFrom(*ret);
-            }
-        });
+    for (const auto& bytes : byte_cache->get(keys, load)) {
+        if (bytes != nullptr) {
+            resp.add_data(*bytes);
+        } else {
+            resp.add_data();
+        }
     }
+}
 
-    std::unique_lock<std::mutex> lk(resp_mutex);
-    resp_cv.wait(lk, [&finished_count, &req] { return finished_count >= req.types().size(); });
-
-    return resp.SerializeAsString();
+// Like reads, removals are only done in an out_dir thumbnails were written to, and only
+// of thumbnails in its index.
+static void remove_thumbnails(const RemoveThumbnailsRequest& req, RemoveThumbnailsResponse& resp) {
+    ThumbnailCache* cache = ThumbnailCache::existing(req.out_dir());
+    for (const proto::ThumbnailRef& ref : req.thumbnails()) {
+        resp.add_removed(cache != nullptr && !ref.image_id().empty() &&
+                         cache->remove(ref.image_id(), ref.type()));
+    }
 }
@@ -0,0 +1,89 @@
+//
+// Row by row PNG decoding, for thumbnails of images too large to hold.
+//
+
+#include "png_rows.h"
+
+#include <png.h>
+
+#include <csetjmp>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+// On the heap, so that what libpng changes after setjmp is still valid after longjmp.
+struct PngReader {
+    explicit PngReader(std::string_view bytes) : bytes(bytes) {
+        png = png_create_read_struct(PNG_LIBPNG_VER_STRING, this, error_fn, warning_fn);
+        if (png == nullptr || (info = png_create_info_struct(png)) == nullptr) {
+            throw std::runtime_error("cannot create png reader");
+        }
+        png_set_read_fn(png, this, read_fn);
+    }
+    ~PngReader() { png_destroy_read_struct(&png, info ? &info : nullptr, nullptr); }
+    PngReader(const PngReader&) = delete;
+    void operator=(const PngReader&) = delete;
+
+    static void read_fn(png_structp png, png_bytep out, png_size_t length) {
+        auto* reader = static_cast<PngReader*>(png_get_io_ptr(png));
+        if (length > reader->bytes.size() - reader->offset) {
+            png_error(png, "unexpected end of data");
+        }
+        std::memcpy(out, reader->bytes.data() + reader->offset, length);
+        reader->offset += length;
+    }
+
+    static void error_fn(png_structp png, png_const_charp message) {
+        static_cast<PngReader*>(png_get_error_ptr(png))->message = message;
+        png_longjmp(png, 1);
+    }
+
+    // warnings about recoverable damage are not worth a line per image
+    static void warning_fn(png_structp, png_const_charp) {}
+
+    png_structp png = nullptr;
+    png_infop info = nullptr;
+    std::string_view bytes;
+    size_t offset = 0;
+    std::string message;
+    std::vector<uint8_t> row;
+};
+
+}  // namespace
+
+bool read_png_rows(std::string_view bytes, RowSink& sink) {
+    auto reader = std::make_unique<PngReader>(bytes);
+    png_structp png = reader->png;
+    png_infop info = reader->info;
+    // errors jump back here, nothing created after this line may need a destructor
+    if (setjmp(png_jmpbuf(png))) {
+        throw std::runtime_error(reader->message);
+    }
+
+    png_read_info(png, info);
+    if (png_get_interlace_type(png, info) != PNG_INTERLACE_NONE) {
+        return false;
+    }
+
+    // palette, gray and 16-bit samples all come out as 8-bit RGB, tRNS as alpha
+    png_set_expand(png);
+    png_set_scale_16(png);
+    png_set_gray_to_rgb(png);
+    png_read_update_info(png, info);
+
+    int width = static_cast<int>(png_get_image_width(png, info));
+    int height = static_cast<int>(png_get_image_height(png, info));
+    int channels = png_get_channels(png, info);
+    reader->row.resize(png_get_rowbytes(png, info));
+    sink.start(width, height, width, height, channels);
+    for (int y = 0; y < height; y++) {
+        png_read_row(png, reader->row.data(), nullptr);
+        sink.row(reader->row.data());
+    }
+    png_read_end(png, nullptr);
+    return true;
+}
@@ -0,0 +1,14 @@
+//
+// Row by row PNG decoding, for thumbnails of images too large to hold.
+//
+
+#pragma once
+
+#include <string_view>
+
+#include "row_sink.h"
+
+// Decodes bytes into sink as 8-bit RGB or RGBA, whatever the bit depth, palette or
+// gray of the source. Returns false for interlaced PNGs, whose rows only come
+// complete in the last pass; throws std::runtime_error on corrupt data.
+bool read_png_rows(std::string_view bytes, RowSink& sink);
@@ -12,13 +12,18 @@
 
 using proto::ExifInfo;
 
-std::optional<ExifInfo> read_exif(const std::string& path) {
-    std::ifstream fstrm(path);
-    std::stringstream buffer;
-    buffer << fstrm.rdbuf();
-
+std::optional<ExifInfo> read_exif(const std::string& path, std::string_view src_bytes) {
     easyexif::EXIFInfo parser;
-    int ret = parser.parseFrom(buffer.str());
+    int ret;
+    if (!src_bytes.empty()) {
+        ret = parser.parseFrom(reinterpret_cast<const unsigned char*>(src_bytes.data()),
+                               src_bytes.size());
+    } else {
+        std::ifstream fstrm(path);
+        std::stringstream buffer;
+        buffer << fstrm.rdbuf();
+        ret = parser.parseFrom(buffer.str());
+    }
 
     if (ret != PARSE_EXIF_SUCCESS) {
         std::cerr << "parse error" << std::endl;
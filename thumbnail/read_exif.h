@@ -6,5 +6,7 @@
 #include <ipc-message/ipc.pb.h>
 
 #include <optional>
+#include <string_view>
 
-std::optional<proto::ExifInfo> read_exif(const std::string& path);
+// Parses src_bytes if not empty, otherwise reads the file at path.
+std::optional<proto::ExifInfo> read_exif(const std::string& path, std::string_view src_bytes = {});
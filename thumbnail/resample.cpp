@@ -0,0 +1,570 @@
+//
+// Separable resampling of 8-bit images for thumbnails.
+//
+
+#include "resample.h"
+
+#include <ThreadPool/ThreadPool.h>
+
+#include <algorithm>
+#include <boost/gil/extension/numeric/resample.hpp>
+#include <boost/gil/extension/numeric/sampler.hpp>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define RESAMPLE_X86 1
+#include <immintrin.h>
+#endif
+
+using namespace boost::gil;
+
+namespace {
+
+constexpr int kPrecisionBits = 14;
+constexpr int32_t kRound = 1 << (kPrecisionBits - 1);
+constexpr double kPi = 3.14159265358979323846;
+
+// Weights of the source pixels that make up each output pixel along one axis.
+struct Coefficients {
+    // first source index and number of taps of each output index
+    std::vector<int> first;
+    std::vector<int> count;
+    // the taps of output index i start at weights[i * stride]
+    std::vector<int16_t> weights;
+    int stride = 0;
+
+    const int16_t* of(int i) const { return &weights[static_cast<size_t>(i) * stride]; }
+};
+
+struct Filter {
+    // half width of the kernel at scale 1
+    double support;
+    double (*weight)(double x);
+};
+
+double box(double x) { return x >= -0.5 && x < 0.5 ? 1.0 : 0.0; }
+
+double triangle(double x) {
+    x = std::abs(x);
+    return x < 1.0 ? 1.0 - x : 0.0;
+}
+
+double sinc(double x) {
+    if (x == 0.0) {
+        return 1.0;
+    }
+    x *= kPi;
+    return std::sin(x) / x;
+}
+
+double lanczos3(double x) { return x > -3.0 && x < 3.0 ? sinc(x) * sinc(x / 3.0) : 0.0; }
+
+Filter filter_of(ResampleFilter filter) {
+    switch (filter) {
+        case ResampleFilter::Box:
+            return {0.5, box};
+        case ResampleFilter::Bilinear:
+        case ResampleFilter::Triangle:
+            return {1.0, triangle};
+        default:
+            return {3.0, lanczos3};
+    }
+}
+
+// When shrinking, the kernel is stretched by in_size / out_size so that every source
+// pixel contributes (which is what keeps the result from aliasing).
+Coefficients compute_coefficients(int in_size, int out_size, const Filter& filter) {
+    double scale = static_cast<double>(in_size) / out_size;
+    double filter_scale = std::max(scale, 1.0);
+    double support = filter.support * filter_scale;
+
+    Coefficients c;
+    c.stride = static_cast<int>(std::ceil(support)) * 2 + 1;
+    c.first.resize(out_size);
+    c.count.resize(out_size);
+    c.weights.assign(static_cast<size_t>(out_size) * c.stride, 0);
+
+    std::vector<double> w(c.stride);
+    for (int i = 0; i < out_size; i++) {
+        double center = (i + 0.5) * scale;
+        int begin = std::max(static_cast<int>(center - support + 0.5), 0);
+        int end = std::min(static_cast<int>(center + support + 0.5), in_size);
+        end = std::max(std::min(end, begin + c.stride), begin + 1);
+
+        double sum = 0;
+        for (int k = 0; k < end - begin; k++) {
+            w[k] = filter.weight((begin + k - center + 0.5) / filter_scale);
+            sum += w[k];
+        }
+
+        // in fixed point, with the rounding error put on the largest weight so that
+        // they still add up to one and flat areas stay flat
+        int16_t* out = &c.weights[static_cast<size_t>(i) * c.stride];
+        int total = 0;
+        int largest = 0;
+        for (int k = 0; k < end - begin; k++) {
+            double normalized = sum != 0 ? w[k] / sum : (k == 0 ? 1.0 : 0.0);
+            long fixed = std::lround(normalized * (1 << kPrecisionBits));
+            out[k] = static_cast<int16_t>(std::clamp<long>(fixed, INT16_MIN, INT16_MAX));
+            total += out[k];
+            if (out[k] > out[largest]) {
+                largest = k;
+            }
+        }
+        out[largest] = static_cast<int16_t>(out[largest] + (1 << kPrecisionBits) - total);
+
+        c.first[i] = begin;
+        c.count[i] = end - begin;
+    }
+    return c;
+}
+
+inline uint8_t clamp8(int32_t v) { return static_cast<uint8_t>(std::clamp(v, 0, 255)); }
+
+// One row of RGB pixels, src_width wide, into the output columns of xs.
+using HorizontalKernel = void (*)(const uint8_t* src, int src_width, uint8_t* dst,
+                                  const Coefficients& xs);
+// Weighs count rows of bytes, stride apart, into dst.
+using VerticalKernel = void (*)(const uint8_t* rows, size_t stride, const int16_t* weights,
+                                int count, uint8_t* dst, size_t bytes);
+
+void horizontal_scalar(const uint8_t* src, int src_width, uint8_t* dst, const Coefficients& xs) {
+    int out_width = static_cast<int>(xs.first.size());
+    for (int x = 0; x < out_width; x++) {
+        const uint8_t* p = src + 3 * xs.first[x];
+        const int16_t* w = xs.of(x);
+        int32_t r = kRound, g = kRound, b = kRound;
+        for (int k = 0; k < xs.count[x]; k++, p += 3) {
+            r += p[0] * w[k];
+            g += p[1] * w[k];
+            b += p[2] * w[k];
+        }
+        dst[3 * x] = clamp8(r >> kPrecisionBits);
+        dst[3 * x + 1] = clamp8(g >> kPrecisionBits);
+        dst[3 * x + 2] = clamp8(b >> kPrecisionBits);
+    }
+}
+
+void vertical_scalar(const uint8_t* rows, size_t stride, const int16_t* weights, int count,
+                     uint8_t* dst, size_t bytes) {
+    for (size_t i = 0; i < bytes; i++) {
+        int32_t acc = kRound;
+        const uint8_t* p = rows + i;
+        for (int k = 0; k < count; k++, p += stride) {
+            acc += *p * weights[k];
+        }
+        dst[i] = clamp8(acc >> kPrecisionBits);
+    }
+}
+
+#ifdef RESAMPLE_X86
+
+// Both passes multiply pairs of 8-bit samples widened to 16 bits with a pair of
+// weights (pmaddwd), adding two taps per instruction into 32-bit sums.
+
+inline int32_t weight_pair(const int16_t* w) {
+    return static_cast<uint16_t>(w[0]) | static_cast<int32_t>(static_cast<uint16_t>(w[1])) << 16;
+}
+
+// output pixels [begin, end) of a row
+__attribute__((target("sse4.1"))) void horizontal_sse41_range(const uint8_t* src, int src_width,
+                                                              uint8_t* dst,
+                                                              const Coefficients& xs, int begin,
+                                                              int end) {
+    // r0 r1 g0 g1 b0 b1 of two adjacent pixels as 16-bit lanes
+    const __m128i pairs = _mm_setr_epi8(0, -1, 3, -1, 1, -1, 4, -1, 2, -1, 5, -1, -1, -1, -1, -1);
+    const uint8_t* row_end = src + 3 * static_cast<size_t>(src_width);
+    for (int x = begin; x < end; x++) {
+        const uint8_t* p = src + 3 * xs.first[x];
+        const int16_t* w = xs.of(x);
+        int count = xs.count[x];
+        __m128i acc = _mm_set1_epi32(kRound);
+        int k = 0;
+        // an 8-byte load covers two pixels and must stay inside the row
+        for (; k + 1 < count && p + 8 <= row_end; k += 2, p += 6) {
+            __m128i pixels =
+                _mm_shuffle_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)), pairs);
+            acc = _mm_add_epi32(acc, _mm_madd_epi16(pixels, _mm_set1_epi32(weight_pair(w + k))));
+        }
+        for (; k < count; k++, p += 3) {
+            int32_t pixel = p[0] | p[1] << 8 | p[2] << 16;
+            __m128i pixels = _mm_shuffle_epi8(_mm_cvtsi32_si128(pixel), pairs);
+            __m128i weight = _mm_set1_epi32(static_cast<uint16_t>(w[k]));
+            acc = _mm_add_epi32(acc, _mm_madd_epi16(pixels, weight));
+        }
+        acc = _mm_srai_epi32(acc, kPrecisionBits);
+        acc = _mm_packus_epi16(_mm_packs_epi32(acc, acc), acc);
+        int32_t rgb = _mm_cvtsi128_si32(acc);
+        std::memcpy(dst + 3 * x, &rgb, 3);
+    }
+}
+
+__attribute__((target("sse4.1"))) void horizontal_sse41(const uint8_t* src, int src_width,
+                                                        uint8_t* dst, const Coefficients& xs) {
+    horizontal_sse41_range(src, src_width, dst, xs, 0, static_cast<int>(xs.first.size()));
+}
+
+__attribute__((target("sse4.1"))) void vertical_sse41(const uint8_t* rows, size_t stride,
+                                                      const int16_t* weights, int count,
+                                                      uint8_t* dst, size_t bytes) {
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 8 <= bytes; i += 8) {
+        __m128i lo = _mm_set1_epi32(kRound);
+        __m128i hi = lo;
+        const uint8_t* p = rows + i;
+        int k = 0;
+        for (; k + 1 < count; k += 2, p += 2 * stride) {
+            __m128i a = _mm_cvtepu8_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+            __m128i b =
+                _mm_cvtepu8_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p + stride)));
+            __m128i w = _mm_set1_epi32(weight_pair(weights + k));
+            lo = _mm_add_epi32(lo, _mm_madd_epi16(_mm_unpacklo_epi16(a, b), w));
+            hi = _mm_add_epi32(hi, _mm_madd_epi16(_mm_unpackhi_epi16(a, b), w));
+        }
+        if (k < count) {
+            __m128i a = _mm_cvtepu8_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+            __m128i w = _mm_set1_epi32(static_cast<uint16_t>(weights[k]));
+            lo = _mm_add_epi32(lo, _mm_madd_epi16(_mm_unpacklo_epi16(a, zero), w));
+            hi = _mm_add_epi32(hi, _mm_madd_epi16(_mm_unpackhi_epi16(a, zero), w));
+        }
+        lo = _mm_srai_epi32(lo, kPrecisionBits);
+        hi = _mm_srai_epi32(hi, kPrecisionBits);
+        __m128i packed = _mm_packus_epi16(_mm_packs_epi32(lo, hi), zero);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i), packed);
+    }
+    vertical_scalar(rows + i, stride, weights, count, dst + i, bytes - i);
+}
+
+// Two output pixels at a time, one per 128-bit lane; the taps one has beyond the
+// other, or that are too close to the end of the row, go through the SSE loop.
+__attribute__((target("avx2"))) void horizontal_avx2(const uint8_t* src, int src_width,
+                                                     uint8_t* dst, const Coefficients& xs) {
+    const __m256i pairs = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8(0, -1, 3, -1, 1, -1, 4, -1, 2, -1, 5, -1, -1, -1, -1, -1));
+    const uint8_t* row_end = src + 3 * static_cast<size_t>(src_width);
+    int out_width = static_cast<int>(xs.first.size());
+    int x = 0;
+    for (; x + 1 < out_width; x += 2) {
+        const uint8_t* p[2] = {src + 3 * xs.first[x], src + 3 * xs.first[x + 1]};
+        const int16_t* w[2] = {xs.of(x), xs.of(x + 1)};
+        int count[2] = {xs.count[x], xs.count[x + 1]};
+        int common = std::min(count[0], count[1]);
+        __m256i acc = _mm256_set1_epi32(kRound);
+        int k = 0;
+        for (; k + 1 < common && p[1] + 3 * k + 8 <= row_end; k += 2) {
+            __m256i pixels = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(
+                    _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p[0] + 3 * k))),
+                _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p[1] + 3 * k)), 1);
+            __m256i weights = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_set1_epi32(weight_pair(w[0] + k))),
+                _mm_set1_epi32(weight_pair(w[1] + k)), 1);
+            acc = _mm256_add_epi32(acc,
+                                   _mm256_madd_epi16(_mm256_shuffle_epi8(pixels, pairs), weights));
+        }
+
+        __m128i halves[2] = {_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1)};
+        for (int i = 0; i < 2; i++) {
+            const uint8_t* q = p[i] + 3 * k;
+            for (int j = k; j < count[i]; j++, q += 3) {
+                int32_t pixel = q[0] | q[1] << 8 | q[2] << 16;
+                __m128i pixels = _mm_shuffle_epi8(_mm_cvtsi32_si128(pixel),
+                                                  _mm256_castsi256_si128(pairs));
+                __m128i weight = _mm_set1_epi32(static_cast<uint16_t>(w[i][j]));
+                halves[i] = _mm_add_epi32(halves[i], _mm_madd_epi16(pixels, weight));
+            }
+            __m128i sum = _mm_srai_epi32(halves[i], kPrecisionBits);
+            sum = _mm_packus_epi16(_mm_packs_epi32(sum, sum), sum);
+            int32_t rgb = _mm_cvtsi128_si32(sum);
+            std::memcpy(dst + 3 * (x + i), &rgb, 3);
+        }
+    }
+    horizontal_sse41_range(src, src_width, dst, xs, x, out_width);
+}
+
+__attribute__((target("avx2"))) void vertical_avx2(const uint8_t* rows, size_t stride,
+                                                   const int16_t* weights, int count,
+                                                   uint8_t* dst, size_t bytes) {
+    const __m256i zero = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 16 <= bytes; i += 16) {
+        // lo holds bytes 0-3 and 8-11, hi 4-7 and 12-15, which packing puts back in order
+        __m256i lo = _mm256_set1_epi32(kRound);
+        __m256i hi = lo;
+        const uint8_t* p = rows + i;
+        int k = 0;
+        for (; k + 1 < count; k += 2, p += 2 * stride) {
+            __m256i a =
+                _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+            __m256i b = _mm256_cvtepu8_epi16(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + stride)));
+            __m256i w = _mm256_set1_epi32(weight_pair(weights + k));
+            lo = _mm256_add_epi32(lo, _mm256_madd_epi16(_mm256_unpacklo_epi16(a, b), w));
+            hi = _mm256_add_epi32(hi, _mm256_madd_epi16(_mm256_unpackhi_epi16(a, b), w));
+        }
+        if (k < count) {
+            __m256i a =
+                _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+            __m256i w = _mm256_set1_epi32(static_cast<uint16_t>(weights[k]));
+            lo = _mm256_add_epi32(lo, _mm256_madd_epi16(_mm256_unpacklo_epi16(a, zero), w));
+            hi = _mm256_add_epi32(hi, _mm256_madd_epi16(_mm256_unpackhi_epi16(a, zero), w));
+        }
+        lo = _mm256_srai_epi32(lo, kPrecisionBits);
+        hi = _mm256_srai_epi32(hi, kPrecisionBits);
+        __m256i packed = _mm256_packus_epi16(_mm256_packs_epi32(lo, hi), zero);
+        packed = _mm256_permute4x64_epi64(packed, 0x08);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm256_castsi256_si128(packed));
+    }
+    vertical_sse41(rows + i, stride, weights, count, dst + i, bytes - i);
+}
+
+#endif
+
+struct Kernels {
+    HorizontalKernel horizontal;
+    VerticalKernel vertical;
+};
+
+Kernels kernels_for(ResampleIsa isa) {
+#ifdef RESAMPLE_X86
+    // never more than the CPU has, whatever was asked for
+    isa = std::min(isa, best_resample_isa());
+    switch (isa) {
+        case ResampleIsa::Avx2:
+            return {horizontal_avx2, vertical_avx2};
+        case ResampleIsa::Sse41:
+            return {horizontal_sse41, vertical_sse41};
+        default:
+            break;
+    }
+#endif
+    return {horizontal_scalar, vertical_scalar};
+}
+
+const uint8_t* source_row(const rgb8c_view_t& src, int y, std::vector<uint8_t>&) {
+    return reinterpret_cast<const uint8_t*>(&src(0, y));
+}
+
+// composited on black, as gil's rgba to rgb conversion does
+void composite_on_black(const uint8_t* rgba, size_t width, uint8_t* rgb) {
+    for (size_t x = 0; x < width; x++, rgba += 4, rgb += 3) {
+        int alpha = rgba[3];
+        rgb[0] = static_cast<uint8_t>((rgba[0] * alpha + 127) / 255);
+        rgb[1] = static_cast<uint8_t>((rgba[1] * alpha + 127) / 255);
+        rgb[2] = static_cast<uint8_t>((rgba[2] * alpha + 127) / 255);
+    }
+}
+
+const uint8_t* source_row(const rgba8c_view_t& src, int y, std::vector<uint8_t>& rgb) {
+    auto width = static_cast<size_t>(src.width());
+    rgb.resize(3 * width);
+    composite_on_black(reinterpret_cast<const uint8_t*>(&src(0, y)), width, rgb.data());
+    return rgb.data();
+}
+
+// about this many bytes of output per strip, so that small thumbnails stay on one thread
+constexpr size_t kStripBytes = 64 * 1024;
+
+template <typename F>
+void for_strips(ThreadPool* pool, size_t rows, size_t row_bytes, F&& fn) {
+    size_t grain = std::max<size_t>(1, kStripBytes / std::max<size_t>(row_bytes, 1));
+    if (pool == nullptr || rows <= grain) {
+        fn(size_t(0), rows);
+        return;
+    }
+    pool->parallel_for(0, rows, grain, std::forward<F>(fn));
+}
+
+template <typename SrcView>
+void resample_separable(const SrcView& src, const rgb8_view_t& dst, ResampleFilter filter,
+                        ThreadPool* pool, ResampleIsa isa) {
+    int in_width = static_cast<int>(src.width());
+    int in_height = static_cast<int>(src.height());
+    int out_width = static_cast<int>(dst.width());
+    int out_height = static_cast<int>(dst.height());
+    if (in_width <= 0 || in_height <= 0 || out_width <= 0 || out_height <= 0) {
+        return;
+    }
+
+    Filter f = filter_of(filter);
+    Coefficients xs = compute_coefficients(in_width, out_width, f);
+    Coefficients ys = compute_coefficients(in_height, out_height, f);
+    Kernels kernels = kernels_for(isa);
+
+    // the horizontal pass only covers the source rows the vertical one reads
+    int first_row = ys.first.front();
+    int end_row = ys.first.back() + ys.count.back();
+    size_t row_bytes = 3 * static_cast<size_t>(out_width);
+    std::vector<uint8_t> columns(row_bytes * (end_row - first_row));
+
+    for_strips(pool, end_row - first_row, row_bytes, [&](size_t begin, size_t end) {
+        std::vector<uint8_t> rgb;
+        for (size_t y = begin; y < end; y++) {
+            const uint8_t* row = source_row(src, first_row + static_cast<int>(y), rgb);
+            kernels.horizontal(row, in_width, &columns[y * row_bytes], xs);
+        }
+    });
+
+    for_strips(pool, out_height, row_bytes, [&](size_t begin, size_t end) {
+        for (size_t y = begin; y < end; y++) {
+            int i = static_cast<int>(y);
+            kernels.vertical(&columns[(ys.first[i] - first_row) * row_bytes], row_bytes, ys.of(i),
+                             ys.count[i], reinterpret_cast<uint8_t*>(&dst(0, i)), row_bytes);
+        }
+    });
+}
+
+template <typename SrcView>
+void resample_any(const SrcView& src, const rgb8_view_t& dst, ResampleFilter filter,
+                  ThreadPool* pool, ResampleIsa isa) {
+    if (filter == ResampleFilter::Bilinear) {
+        resize_view(src, dst, bilinear_sampler{});
+        return;
+    }
+    resample_separable(src, dst, filter, pool, isa);
+}
+
+}  // namespace
+
+bool parse_resample_filter(const std::string& name, ResampleFilter& filter) {
+    for (auto candidate : {ResampleFilter::Bilinear, ResampleFilter::Box, ResampleFilter::Triangle,
+                           ResampleFilter::Lanczos3}) {
+        if (name == resample_filter_name(candidate)) {
+            filter = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+const char* resample_filter_name(ResampleFilter filter) {
+    switch (filter) {
+        case ResampleFilter::Bilinear:
+            return "bilinear";
+        case ResampleFilter::Box:
+            return "box";
+        case ResampleFilter::Triangle:
+            return "triangle";
+        case ResampleFilter::Lanczos3:
+            return "lanczos3";
+    }
+    return "";
+}
+
+ResampleIsa best_resample_isa() {
+#ifdef RESAMPLE_X86
+    static const ResampleIsa best = [] {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            return ResampleIsa::Avx2;
+        }
+        if (__builtin_cpu_supports("sse4.1")) {
+            return ResampleIsa::Sse41;
+        }
+        return ResampleIsa::Scalar;
+    }();
+    return best;
+#else
+    return ResampleIsa::Scalar;
+#endif
+}
+
+const char* resample_isa_name(ResampleIsa isa) {
+    switch (isa) {
+        case ResampleIsa::Scalar:
+            return "scalar";
+        case ResampleIsa::Sse41:
+            return "sse4.1";
+        case ResampleIsa::Avx2:
+            return "avx2";
+    }
+    return "";
+}
+
+void resample_view(const rgb8c_view_t& src, const rgb8_view_t& dst, ResampleFilter filter,
+                   ThreadPool* pool, ResampleIsa isa) {
+    resample_any(src, dst, filter, pool, isa);
+}
+
+void resample_view(const rgba8c_view_t& src, const rgb8_view_t& dst, ResampleFilter filter,
+                   ThreadPool* pool, ResampleIsa isa) {
+    resample_any(src, dst, filter, pool, isa);
+}
+
+// The window is stored twice over, row r at slots r % window and r % window + window,
+// so that the rows of any output row are contiguous for the vertical kernel.
+struct RowResampler::State {
+    State(int src_width, int src_height, const rgb8_view_t& dst, ResampleFilter filter,
+          ResampleIsa isa)
+        : src_width(src_width),
+          dst(dst),
+          xs(compute_coefficients(src_width, static_cast<int>(dst.width()), filter_of(filter))),
+          ys(compute_coefficients(src_height, static_cast<int>(dst.height()), filter_of(filter))),
+          kernels(kernels_for(isa)),
+          window(ys.stride),
+          row_bytes(3 * static_cast<size_t>(dst.width())),
+          rows(2 * window * row_bytes),
+          rgb(3 * static_cast<size_t>(src_width)) {}
+
+    void push(const uint8_t* row) {
+        int y = next_in++;
+        // rows above the first output row's taps or below the last one's are not read
+        if (next_out >= static_cast<int>(dst.height()) || y < ys.first[next_out]) {
+            return;
+        }
+        uint8_t* slot = &rows[(y % window) * row_bytes];
+        kernels.horizontal(row, src_width, slot, xs);
+        std::memcpy(slot + window * row_bytes, slot, row_bytes);
+
+        while (next_out < static_cast<int>(dst.height()) &&
+               ys.first[next_out] + ys.count[next_out] <= next_in) {
+            kernels.vertical(&rows[(ys.first[next_out] % window) * row_bytes], row_bytes,
+                             ys.of(next_out), ys.count[next_out],
+                             reinterpret_cast<uint8_t*>(&dst(0, next_out)), row_bytes);
+            next_out++;
+        }
+    }
+
+    const int src_width;
+    const rgb8_view_t dst;
+    const Coefficients xs;
+    const Coefficients ys;
+    const Kernels kernels;
+    const int window;
+    const size_t row_bytes;
+    std::vector<uint8_t> rows;
+    // an RGBA row composited
+    std::vector<uint8_t> rgb;
+    int next_in = 0;
+    int next_out = 0;
+};
+
+RowResampler::RowResampler(int src_width, int src_height, const rgb8_view_t& dst,
+                           ResampleFilter filter, ResampleIsa isa) {
+    if (src_width > 0 && src_height > 0 && dst.width() > 0 && dst.height() > 0) {
+        state = std::make_unique<State>(src_width, src_height, dst, filter, isa);
+    }
+}
+
+RowResampler::~RowResampler() = default;
+
+void RowResampler::push_rgb(const uint8_t* row) {
+    if (state) {
+        state->push(row);
+    }
+}
+
+void RowResampler::push_rgba(const uint8_t* row) {
+    if (state) {
+        composite_on_black(row, state->rgb.size() / 3, state->rgb.data());
+        state->push(state->rgb.data());
+    }
+}
+
+bool RowResampler::done() const {
+    return state && state->next_out == static_cast<int>(state->dst.height());
+}
@@ -0,0 +1,72 @@
+//
+// Separable resampling of 8-bit images for thumbnails.
+//
+
+#pragma once
+
+#include <boost/gil.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+class ThreadPool;
+
+enum class ResampleFilter {
+    // gil's bilinear_sampler: one interpolated source point per pixel, which aliases
+    // once an image shrinks more than 2x. Kept for comparison.
+    Bilinear,
+    // the average of the source pixels each output pixel covers
+    Box,
+    Triangle,
+    Lanczos3,
+};
+
+// "bilinear", "box", "triangle" or "lanczos3"
+bool parse_resample_filter(const std::string& name, ResampleFilter& filter);
+const char* resample_filter_name(ResampleFilter filter);
+
+// Instruction sets the kernels are built for; SSE4.1 and AVX2 only on x86 with
+// GCC or Clang, picked at run time.
+enum class ResampleIsa { Scalar, Sse41, Avx2 };
+
+// the best one this CPU supports
+ResampleIsa best_resample_isa();
+const char* resample_isa_name(ResampleIsa isa);
+
+// Resizes src into dst with weights precomputed per output row and column: a
+// horizontal pass over the source rows, then a vertical one over the output rows,
+// each in 14-bit fixed point. RGBA sources are composited on black like gil's
+// conversion to RGB. Strips of rows run on pool when given, the caller's thread
+// helping.
+void resample_view(const boost::gil::rgb8c_view_t& src, const boost::gil::rgb8_view_t& dst,
+                   ResampleFilter filter, ThreadPool* pool = nullptr,
+                   ResampleIsa isa = best_resample_isa());
+void resample_view(const boost::gil::rgba8c_view_t& src, const boost::gil::rgb8_view_t& dst,
+                   ResampleFilter filter, ThreadPool* pool = nullptr,
+                   ResampleIsa isa = best_resample_isa());
+
+// The same resampling for a source handed over one row at a time, top to bottom:
+// each row goes through the horizontal pass as it arrives and only the rows the
+// vertical filter still needs are kept, so memory is the size of dst plus a window
+// of dst's width times the filter's taps, however tall the source. One thread;
+// Bilinear is not supported and is treated as Triangle.
+class RowResampler final {
+   public:
+    RowResampler(int src_width, int src_height, const boost::gil::rgb8_view_t& dst,
+                 ResampleFilter filter, ResampleIsa isa = best_resample_isa());
+    ~RowResampler();
+    RowResampler(const RowResampler&) = delete;
+    void operator=(const RowResampler&) = delete;
+
+    // the next source row, src_width RGB pixels
+    void push_rgb(const uint8_t* row);
+    // the next source row, src_width RGBA pixels, composited on black
+    void push_rgba(const uint8_t* row);
+
+    // every row of dst is written
+    bool done() const;
+
+   private:
+    struct State;
+    std::unique_ptr<State> state;
+};
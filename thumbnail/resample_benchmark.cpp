@@ -0,0 +1,141 @@
+//
+// Time to shrink a 12, 24 and 48 MP RGB image to the Large (1024 px) and Small
+// (128 px) thumbnail widths, for gil's bilinear_sampler and for every filter of the
+// separable resampler on each instruction set the CPU has, on one thread and with
+// row strips on a pool.
+//
+// usage: thumbnail_resample_bench [--threads N] [--runs N] [--format csv|json]
+//
+
+#include <ThreadPool/ThreadPool.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "resample.h"
+
+using namespace boost::gil;
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    size_t threads = std::max(1u, std::thread::hardware_concurrency());
+    int runs = 5;
+    bool json = false;
+};
+
+// smooth gradients with noise on top, so that neither the cache nor the branch
+// predictor sees anything simpler than a photo
+static rgb8_image_t make_source(int width, int height) {
+    rgb8_image_t img(width, height);
+    auto v = view(img);
+    std::mt19937 rng(42);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            int noise = static_cast<int>(rng() & 31);
+            v(x, y) = rgb8_pixel_t(static_cast<uint8_t>(x * 200 / width + noise),
+                                   static_cast<uint8_t>(y * 200 / height + noise),
+                                   static_cast<uint8_t>((x + y) & 255));
+        }
+    }
+    return img;
+}
+
+// best of runs, in milliseconds
+static double time_resample(const rgb8_image_t& src, rgb8_image_t& dst, ResampleFilter filter,
+                            ThreadPool* pool, ResampleIsa isa, int runs) {
+    double best = 1e300;
+    for (int i = 0; i < runs; i++) {
+        auto start = Clock::now();
+        resample_view(const_view(src), view(dst), filter, pool, isa);
+        best = std::min(best,
+                        std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+    }
+    return best;
+}
+
+static bool parse_options(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc)
+            return false;
+        if (arg == "--threads") {
+            options.threads = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--runs") {
+            options.runs = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--format") {
+            options.json = std::string(argv[++i]) == "json";
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parse_options(argc, argv, options)) {
+        std::cerr << "usage: thumbnail_resample_bench [--threads N] [--runs N] "
+                     "[--format csv|json]"
+                  << std::endl;
+        return 1;
+    }
+
+    ThreadPool pool("resample", options.threads, ThreadPool::Scheduling::WorkStealing);
+
+    if (!options.json)
+        std::printf("source_mp,target_width,filter,isa,threads,ms,speedup_vs_gil\n");
+
+    const std::pair<int, int> sources[] = {{4000, 3000}, {6000, 4000}, {8000, 6000}};
+    const int targets[] = {1024, 128};
+    std::vector<ResampleIsa> isas = {ResampleIsa::Scalar};
+    if (best_resample_isa() >= ResampleIsa::Sse41)
+        isas.push_back(ResampleIsa::Sse41);
+    if (best_resample_isa() >= ResampleIsa::Avx2)
+        isas.push_back(ResampleIsa::Avx2);
+
+    for (const auto& source : sources) {
+        rgb8_image_t src = make_source(source.first, source.second);
+        int megapixels = source.first * source.second / 1000000;
+        for (int target : targets) {
+            rgb8_image_t dst(target, target * source.second / source.first);
+            double gil_ms = 0;
+
+            auto report = [&](ResampleFilter filter, ResampleIsa isa, size_t threads,
+                              double ms) {
+                const char* format =
+                    options.json
+                        ? "{\"source_mp\":%d,\"target_width\":%d,\"filter\":\"%s\","
+                          "\"isa\":\"%s\",\"threads\":%zu,\"ms\":%.3f,\"speedup_vs_gil\":%.2f}\n"
+                        : "%d,%d,%s,%s,%zu,%.3f,%.2f\n";
+                std::printf(format, megapixels, target, resample_filter_name(filter),
+                            filter == ResampleFilter::Bilinear ? "gil" : resample_isa_name(isa),
+                            threads, ms, gil_ms / ms);
+                std::fflush(stdout);
+            };
+
+            gil_ms = time_resample(src, dst, ResampleFilter::Bilinear, nullptr,
+                                   ResampleIsa::Scalar, options.runs);
+            report(ResampleFilter::Bilinear, ResampleIsa::Scalar, 1, gil_ms);
+
+            for (auto filter :
+                 {ResampleFilter::Box, ResampleFilter::Triangle, ResampleFilter::Lanczos3}) {
+                for (ResampleIsa isa : isas) {
+                    report(filter, isa, 1,
+                           time_resample(src, dst, filter, nullptr, isa, options.runs));
+                }
+                if (options.threads > 1) {
+                    report(filter, isas.back(), options.threads,
+                           time_resample(src, dst, filter, &pool, isas.back(), options.runs));
+                }
+            }
+        }
+    }
+    return 0;
+}
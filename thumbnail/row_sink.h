@@ -0,0 +1,19 @@
+//
+// Images handed over one row at a time, by decoders that do not keep the whole image.
+//
+
+#pragma once
+
+#include <cstdint>
+
+class RowSink {
+   public:
+    virtual ~RowSink() = default;
+
+    // Once, before the rows: the size of the source and that of the rows that follow,
+    // smaller when the decoder scaled it, with 3 (RGB) or 4 (RGBA) 8-bit channels.
+    virtual void start(int width, int height, int row_width, int rows, int channels) = 0;
+    // Every row, top to bottom. Must not throw, it is called between the calls into a
+    // C decoder that unwinds with longjmp.
+    virtual void row(const uint8_t* pixels) = 0;
+};
@@ -0,0 +1,144 @@
+//
+// JPEG decoding through libjpeg's DCT scaling, for thumbnails of large photos.
+//
+
+#include "scaled_jpeg.h"
+
+// jpeglib.h needs size_t and FILE declared first
+#include <csetjmp>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+#include <jpeglib.h>
+
+namespace {
+
+struct ErrorManager {
+    jpeg_error_mgr pub;
+    std::jmp_buf jump;
+    char message[JMSG_LENGTH_MAX];
+};
+
+// libjpeg must not return from error_exit, it would exit() the process by default
+void error_exit(j_common_ptr cinfo) {
+    auto* err = reinterpret_cast<ErrorManager*>(cinfo->err);
+    (*cinfo->err->format_message)(cinfo, err->message);
+    std::longjmp(err->jump, 1);
+}
+
+// warnings about recoverable damage are not worth a line per image
+void output_message(j_common_ptr) {}
+
+// tried in order, the first that covers the target wins
+constexpr unsigned kScaleDenoms[] = {8, 4, 2};
+
+class ImageSink final : public RowSink {
+   public:
+    explicit ImageSink(boost::gil::rgb8_image_t& img) : img(img) {}
+
+    void start(int source_width, int source_height, int row_width, int rows, int) override {
+        width = source_width;
+        height = source_height;
+        img.recreate(row_width, rows);
+    }
+
+    void row(const uint8_t* pixels) override {
+        std::memcpy(static_cast<void*>(&boost::gil::view(img)(0, y++)), pixels, 3 * img.width());
+    }
+
+    boost::gil::rgb8_image_t& img;
+    int width = 0;
+    int height = 0;
+    int y = 0;
+};
+
+}  // namespace
+
+bool read_scaled_jpeg(std::string_view bytes, const TargetSize& target_size,
+                      boost::gil::rgb8_image_t& img, int& width, int& height) {
+    ImageSink sink(img);
+    if (!read_scaled_jpeg_rows(bytes, target_size, sink)) {
+        return false;
+    }
+    width = sink.width;
+    height = sink.height;
+    return true;
+}
+
+bool read_scaled_jpeg_rows(std::string_view bytes, const TargetSize& target_size, RowSink& sink) {
+    jpeg_decompress_struct cinfo;
+    ErrorManager err;
+    cinfo.err = jpeg_std_error(&err.pub);
+    err.pub.error_exit = error_exit;
+    err.pub.output_message = output_message;
+    // errors jump back here, so nothing in this frame may need a destructor
+    if (setjmp(err.jump)) {
+        jpeg_destroy_decompress(&cinfo);
+        throw std::runtime_error(err.message);
+    }
+
+    jpeg_create_decompress(&cinfo);
+    jpeg_mem_src(&cinfo, reinterpret_cast<const unsigned char*>(bytes.data()),
+                 static_cast<unsigned long>(bytes.size()));
+    jpeg_read_header(&cinfo, TRUE);
+    if (cinfo.jpeg_color_space == JCS_CMYK || cinfo.jpeg_color_space == JCS_YCCK) {
+        jpeg_destroy_decompress(&cinfo);
+        return false;
+    }
+
+    int width = static_cast<int>(cinfo.image_width);
+    int height = static_cast<int>(cinfo.image_height);
+    std::pair<int, int> target = target_size(width, height);
+
+    cinfo.out_color_space = JCS_RGB;
+    cinfo.scale_num = 1;
+    for (unsigned denom : kScaleDenoms) {
+        cinfo.scale_denom = denom;
+        jpeg_calc_output_dimensions(&cinfo);
+        if (static_cast<int>(cinfo.output_width) >= target.first &&
+            static_cast<int>(cinfo.output_height) >= target.second) {
+            break;
+        }
+        cinfo.scale_denom = 1;
+    }
+
+    jpeg_start_decompress(&cinfo);
+    // freed with cinfo, longjmp or not
+    JSAMPARRAY row = (*cinfo.mem->alloc_sarray)(reinterpret_cast<j_common_ptr>(&cinfo),
+                                                JPOOL_IMAGE, cinfo.output_width * 3, 1);
+    try {
+        sink.start(width, height, static_cast<int>(cinfo.output_width),
+                   static_cast<int>(cinfo.output_height), 3);
+    } catch (...) {
+        jpeg_destroy_decompress(&cinfo);
+        throw;
+    }
+    while (cinfo.output_scanline < cinfo.output_height) {
+        jpeg_read_scanlines(&cinfo, row, 1);
+        sink.row(row[0]);
+    }
+    jpeg_finish_decompress(&cinfo);
+    jpeg_destroy_decompress(&cinfo);
+    return true;
+}
+
+void read_jpeg_size(std::string_view bytes, int& width, int& height) {
+    jpeg_decompress_struct cinfo;
+    ErrorManager err;
+    cinfo.err = jpeg_std_error(&err.pub);
+    err.pub.error_exit = error_exit;
+    err.pub.output_message = output_message;
+    if (setjmp(err.jump)) {
+        jpeg_destroy_decompress(&cinfo);
+        throw std::runtime_error(err.message);
+    }
+
+    jpeg_create_decompress(&cinfo);
+    jpeg_mem_src(&cinfo, reinterpret_cast<const unsigned char*>(bytes.data()),
+                 static_cast<unsigned long>(bytes.size()));
+    jpeg_read_header(&cinfo, TRUE);
+    width = static_cast<int>(cinfo.image_width);
+    height = static_cast<int>(cinfo.image_height);
+    jpeg_destroy_decompress(&cinfo);
+}
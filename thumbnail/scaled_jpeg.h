@@ -0,0 +1,30 @@
+//
+// JPEG decoding through libjpeg's DCT scaling, for thumbnails of large photos.
+//
+
+#pragma once
+
+#include <boost/gil.hpp>
+#include <functional>
+#include <string_view>
+#include <utility>
+
+#include "row_sink.h"
+
+// Maps the dimensions of a source to the smallest size its decoded image must cover.
+using TargetSize = std::function<std::pair<int, int>(int width, int height)>;
+
+// Decodes bytes at the smallest of the scales 1/8, 1/4 and 1/2 that still covers
+// target_size(width, height), or at full size when none does. width and height
+// receive the dimensions of the source itself. Returns false for CMYK sources,
+// which libjpeg cannot convert to RGB; throws std::runtime_error on corrupt data.
+bool read_scaled_jpeg(std::string_view bytes, const TargetSize& target_size,
+                      boost::gil::rgb8_image_t& img, int& width, int& height);
+
+// The same decode handing the rows to sink instead of keeping the image; only libjpeg's
+// own buffers (a few rows, or the coefficients of a progressive JPEG) are held.
+bool read_scaled_jpeg_rows(std::string_view bytes, const TargetSize& target_size, RowSink& sink);
+
+// The dimensions of the JPEG in bytes from its header, without decoding it. Throws
+// std::runtime_error if the header is corrupt.
+void read_jpeg_size(std::string_view bytes, int& width, int& height);
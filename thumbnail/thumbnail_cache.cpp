@@ -0,0 +1,371 @@
+#include "thumbnail_cache.h"
+
+#include <boost/filesystem.hpp>
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <sstream>
+
+#include "./utils.h"
+
+static constexpr char IndexFileName[] = "thumbnails.index";
+static constexpr char PackDirName[] = "thumbnails.pack";
+
+static constexpr uint64_t Prime1 = 11400714785074694791ULL;
+static constexpr uint64_t Prime2 = 14029467366897019727ULL;
+static constexpr uint64_t Prime3 = 1609587929392839161ULL;
+static constexpr uint64_t Prime4 = 9650029242287828579ULL;
+static constexpr uint64_t Prime5 = 2870177450012600261ULL;
+
+static inline uint64_t rotl(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+static inline uint64_t read64(const char* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint32_t read32(const char* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint64_t hash_round(uint64_t acc, uint64_t input) {
+    return rotl(acc + input * Prime2, 31) * Prime1;
+}
+
+static inline uint64_t merge_hash_round(uint64_t acc, uint64_t v) {
+    return (acc ^ hash_round(0, v)) * Prime1 + Prime4;
+}
+
+uint64_t content_hash(std::string_view bytes, uint64_t seed) {
+    const char* p = bytes.data();
+    const char* end = p + bytes.size();
+    uint64_t h;
+
+    if (bytes.size() >= 32) {
+        // four independent lanes over 32-byte stripes
+        uint64_t v1 = seed + Prime1 + Prime2;
+        uint64_t v2 = seed + Prime2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - Prime1;
+        for (const char* limit = end - 32; p <= limit; p += 32) {
+            v1 = hash_round(v1, read64(p));
+            v2 = hash_round(v2, read64(p + 8));
+            v3 = hash_round(v3, read64(p + 16));
+            v4 = hash_round(v4, read64(p + 24));
+        }
+        h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+        h = merge_hash_round(h, v1);
+        h = merge_hash_round(h, v2);
+        h = merge_hash_round(h, v3);
+        h = merge_hash_round(h, v4);
+    } else {
+        h = seed + Prime5;
+    }
+    h += bytes.size();
+
+    for (; p + 8 <= end; p += 8) {
+        h = rotl(h ^ hash_round(0, read64(p)), 27) * Prime1 + Prime4;
+    }
+    if (p + 4 <= end) {
+        h = rotl(h ^ (read32(p) * Prime1), 23) * Prime2 + Prime3;
+        p += 4;
+    }
+    for (; p < end; p++) {
+        h = rotl(h ^ (static_cast<uint8_t>(*p) * Prime5), 11) * Prime1;
+    }
+
+    h ^= h >> 33;
+    h *= Prime2;
+    h ^= h >> 29;
+    h *= Prime3;
+    h ^= h >> 32;
+    return h;
+}
+
+static ThreadPool* store_compaction_pool = nullptr;
+static ThumbnailCache::ChangeCallback change_callback;
+
+static std::mutex caches_mutex;
+static std::unordered_map<std::string, std::unique_ptr<ThumbnailCache>> caches;
+
+ThumbnailCache& ThumbnailCache::for_dir(const std::string& out_dir) {
+    std::lock_guard<std::mutex> lock(caches_mutex);
+    auto& cache = caches[out_dir];
+    if (!cache) {
+        cache = std::make_unique<ThumbnailCache>(out_dir, store_compaction_pool);
+    }
+    return *cache;
+}
+
+ThumbnailCache* ThumbnailCache::existing(const std::string& out_dir) {
+    std::lock_guard<std::mutex> lock(caches_mutex);
+    auto it = caches.find(out_dir);
+    if (it != caches.end()) {
+        return it->second.get();
+    }
+
+    boost::filesystem::path dir(out_dir);
+    boost::system::error_code ec;
+    if (!boost::filesystem::is_regular_file(dir / IndexFileName, ec) &&
+        !boost::filesystem::is_directory(dir / PackDirName, ec)) {
+        return nullptr;
+    }
+    auto& cache = caches[out_dir];
+    cache = std::make_unique<ThumbnailCache>(out_dir, store_compaction_pool);
+    return cache.get();
+}
+
+void ThumbnailCache::on_change(ChangeCallback callback) {
+    change_callback = std::move(callback);
+}
+
+void ThumbnailCache::pack_into_stores(ThreadPool& compaction_pool) {
+    store_compaction_pool = &compaction_pool;
+}
+
+std::string ThumbnailCache::source_key(std::string_view src_bytes) {
+    char key[40];
+    std::snprintf(key, sizeof(key), "%016" PRIx64 "-%zx", content_hash(src_bytes),
+                  src_bytes.size());
+    return key;
+}
+
+std::string ThumbnailCache::image_id(const std::string& source_key, const std::string& filter,
+                                     const std::string& ext) {
+    return source_key + "-" + filter + ext;
+}
+
+std::string ThumbnailCache::file_name(const std::string& image_id, proto::ThumbnailType type) {
+    boost::filesystem::path id(image_id);
+    return id.stem().string() + "-" + proto::ThumbnailType_Name(type) + id.extension().string();
+}
+
+void ThumbnailCache::write_line(std::ostream& out, const std::string& name, const Entry& entry) {
+    out << name << ' ' << entry.type << ' ' << entry.width << ' ' << entry.height << '\n';
+}
+
+// The index has one line per thumbnail written, "name type width height", and one per
+// thumbnail removed, "name"; a later line for the same name replaces an earlier one.
+ThumbnailCache::ThumbnailCache(const std::string& out_dir, ThreadPool* compaction_pool)
+    : out_dir(out_dir) {
+    if (compaction_pool != nullptr) {
+        packed = std::make_unique<ThumbnailStore>(path_of(PackDirName), compaction_pool);
+        return;
+    }
+
+    std::string index_path = path_of(IndexFileName);
+    std::ifstream existing(index_path);
+    std::string line;
+    size_t lines = 0;
+    // a last line cut short by a crash has no newline and is skipped
+    while (std::getline(existing, line) && !existing.eof()) {
+        lines++;
+        std::istringstream fields(line);
+        std::string name;
+        int type, width, height;
+        if (!(fields >> name)) {
+            continue;
+        }
+        if (fields >> type >> width >> height && proto::ThumbnailType_IsValid(type)) {
+            entries[name] = Entry{static_cast<proto::ThumbnailType>(type), width, height};
+        } else {
+            entries.erase(name);
+        }
+    }
+    existing.close();
+
+    // thumbnails written again or removed leave stale lines behind
+    if (lines > 2 * entries.size() + 1024) {
+        std::string compacted_path = index_path + ".tmp";
+        std::ofstream compacted(compacted_path, std::ios::trunc);
+        for (const auto& [name, entry] : entries) {
+            write_line(compacted, name, entry);
+        }
+        compacted.close();
+        boost::system::error_code ec;
+        if (compacted) {
+            boost::filesystem::rename(compacted_path, index_path, ec);
+        }
+    }
+
+    index.open(index_path, std::ios::app);
+    if (!index.is_open()) {
+        std::cerr << "cannot open " << index_path << ", thumbnails are not cached" << std::endl;
+    }
+}
+
+std::string ThumbnailCache::path_of(const std::string& name) const {
+    return (boost::filesystem::path(out_dir) / name).string();
+}
+
+std::optional<proto::Thumbnail> ThumbnailCache::find(const std::string& image_id,
+                                                     proto::ThumbnailType type) {
+    proto::Thumbnail thumbnail;
+    thumbnail.set_type(type);
+    thumbnail.set_image_id(image_id);
+    if (packed) {
+        auto bytes = packed->get(image_id, type);
+        if (!bytes) {
+            return std::nullopt;
+        }
+        thumbnail.set_width(bytes->width);
+        thumbnail.set_height(bytes->height);
+        return thumbnail;
+    }
+
+    std::string name = file_name(image_id, type);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(name);
+        if (it == entries.end()) {
+            return std::nullopt;
+        }
+        thumbnail.set_width(it->second.width);
+        thumbnail.set_height(it->second.height);
+    }
+    thumbnail.set_path(path_of(name));
+
+    // deleted behind our back, it is written again
+    boost::system::error_code ec;
+    if (!boost::filesystem::exists(thumbnail.path(), ec)) {
+        return std::nullopt;
+    }
+    return thumbnail;
+}
+
+std::optional<std::string> ThumbnailCache::read(const std::string& image_id,
+                                                proto::ThumbnailType type) {
+    if (packed) {
+        auto bytes = packed->get(image_id, type);
+        if (!bytes) {
+            return std::nullopt;
+        }
+        return std::string(bytes->data);
+    }
+
+    auto thumbnail = find(image_id, type);
+    if (!thumbnail) {
+        return std::nullopt;
+    }
+    std::ifstream file(thumbnail->path(), std::ios::binary);
+    std::ostringstream bytes;
+    if (!(bytes << file.rdbuf())) {
+        return std::nullopt;
+    }
+    return bytes.str();
+}
+
+std::optional<std::string> ThumbnailCache::resolve(const std::string& path) {
+    if (packed) {
+        return std::nullopt;
+    }
+
+    boost::system::error_code ec;
+    boost::filesystem::path resolved = boost::filesystem::canonical(path, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    boost::filesystem::path dir = boost::filesystem::canonical(out_dir, ec);
+    if (ec || resolved.parent_path() != dir ||
+        !boost::filesystem::is_regular_file(resolved, ec)) {
+        return std::nullopt;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    if (entries.count(resolved.filename().string()) == 0) {
+        return std::nullopt;
+    }
+    return resolved.string();
+}
+
+std::optional<proto::Thumbnail> ThumbnailCache::put(const std::string& image_id,
+                                                    proto::ThumbnailType type, int width,
+                                                    int height, std::string_view encoded) {
+    proto::Thumbnail thumbnail;
+    thumbnail.set_type(type);
+    thumbnail.set_image_id(image_id);
+    thumbnail.set_width(width);
+    thumbnail.set_height(height);
+    if (packed) {
+        if (!packed->put(image_id, type, width, height, encoded)) {
+            return std::nullopt;
+        }
+        if (change_callback) {
+            change_callback(*this, thumbnail);
+        }
+        return thumbnail;
+    }
+
+    // written aside and renamed, so that the file is always complete even when the
+    // same photo is being imported twice at once
+    std::string name = file_name(image_id, type);
+    std::string path = path_of(name);
+    std::string temp_path = path + "." + GenRandomString(6) + ".tmp";
+    {
+        std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+        file.write(encoded.data(), static_cast<std::streamsize>(encoded.size()));
+        file.close();
+        boost::system::error_code ec;
+        if (file) {
+            boost::filesystem::rename(temp_path, path, ec);
+        }
+        if (!file || ec) {
+            std::cerr << "cannot write " << path << std::endl;
+            boost::filesystem::remove(temp_path, ec);
+            return std::nullopt;
+        }
+    }
+    thumbnail.set_path(path);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto& entry = entries[name] = Entry{type, width, height};
+        if (index.is_open()) {
+            write_line(index, name, entry);
+            index.flush();
+        }
+    }
+    if (change_callback) {
+        change_callback(*this, thumbnail);
+    }
+    return thumbnail;
+}
+
+bool ThumbnailCache::remove(const std::string& image_id, proto::ThumbnailType type) {
+    proto::Thumbnail thumbnail;
+    thumbnail.set_type(type);
+    thumbnail.set_image_id(image_id);
+    if (packed) {
+        if (!packed->remove(image_id, type)) {
+            return false;
+        }
+        if (change_callback) {
+            change_callback(*this, thumbnail);
+        }
+        return true;
+    }
+
+    std::string name = file_name(image_id, type);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (entries.erase(name) == 0) {
+            return false;
+        }
+        if (index.is_open()) {
+            index << name << '\n';
+            index.flush();
+        }
+    }
+    thumbnail.set_path(path_of(name));
+    boost::system::error_code ec;
+    boost::filesystem::remove(thumbnail.path(), ec);
+    if (change_callback) {
+        change_callback(*this, thumbnail);
+    }
+    return true;
+}
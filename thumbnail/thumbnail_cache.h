@@ -0,0 +1,99 @@
+//
+// Thumbnails stored under names derived from the content of their source, so that
+// a photo imported again, or from another folder, is not decoded again.
+//
+
+#pragma once
+
+#include <ipc-message/ipc.pb.h>
+
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "thumbnail_store.h"
+
+class ThreadPool;
+
+// XXH64 of bytes (little-endian machines)
+uint64_t content_hash(std::string_view bytes, uint64_t seed = 0);
+
+// The thumbnails in one output directory, by image id (ThumbnailCache::image_id) and
+// type. Each is a file there with an index of them, "thumbnails.index", that every
+// thumbnail written or removed is appended to; or, once pack_into_stores() was called,
+// all of them are in a ThumbnailStore in its "thumbnails.pack" subdirectory.
+class ThumbnailCache final {
+   public:
+    // The cache of out_dir, its index read on first use.
+    static ThumbnailCache& for_dir(const std::string& out_dir);
+    // The cache of out_dir if thumbnails were written there: one for_dir() opened, or
+    // one whose index or store an earlier run left in out_dir. null otherwise, and
+    // nothing is created in out_dir.
+    static ThumbnailCache* existing(const std::string& out_dir);
+
+    // Called after every put() with the thumbnail written, which may replace one that
+    // was read before, and after every remove() with the one removed (its path, if it
+    // had one, is gone). Set once, before any thumbnail is written.
+    using ChangeCallback = std::function<void(const ThumbnailCache&, const proto::Thumbnail&)>;
+    static void on_change(ChangeCallback callback);
+
+    // Packs the thumbnails of the caches created from then on, compacting the stores on
+    // compaction_pool.
+    static void pack_into_stores(ThreadPool& compaction_pool);
+
+    // Identifies a source by its content: its hash and its size.
+    static std::string source_key(std::string_view src_bytes);
+    // Identifies the thumbnails made of a source with a filter, the extension telling
+    // their format: "<source_key>-<filter><ext>".
+    static std::string image_id(const std::string& source_key, const std::string& filter,
+                                const std::string& ext);
+
+    ThumbnailCache(const std::string& out_dir, ThreadPool* compaction_pool);
+    ThumbnailCache(const ThumbnailCache&) = delete;
+    void operator=(const ThumbnailCache&) = delete;
+
+    const std::string& dir() const { return out_dir; }
+    // null unless the thumbnails are packed
+    ThumbnailStore* store() const { return packed.get(); }
+
+    // The thumbnail of image_id and type, nullopt if there is none or its file is gone.
+    // Its path is empty when it is packed.
+    std::optional<proto::Thumbnail> find(const std::string& image_id, proto::ThumbnailType type);
+    // The encoded bytes of the thumbnail of image_id and type, nullopt if there is none.
+    std::optional<std::string> read(const std::string& image_id, proto::ThumbnailType type);
+    // The canonical path of the thumbnail file at path, nullopt unless it is one of
+    // this cache: with symlinks resolved it is in out_dir and named in the index.
+    // Always nullopt when the thumbnails are packed.
+    std::optional<std::string> resolve(const std::string& path);
+    // Stores an encoded thumbnail, replacing any earlier one. nullopt if it cannot be
+    // written.
+    std::optional<proto::Thumbnail> put(const std::string& image_id, proto::ThumbnailType type,
+                                        int width, int height, std::string_view encoded);
+    // Deletes the thumbnail of image_id and type, false if there was none. Photos with
+    // the same content share their thumbnails: remove them once none uses them.
+    bool remove(const std::string& image_id, proto::ThumbnailType type);
+
+   private:
+    struct Entry {
+        proto::ThumbnailType type;
+        int width;
+        int height;
+    };
+
+    static void write_line(std::ostream& out, const std::string& name, const Entry& entry);
+    // the name of the file of a thumbnail: "<source_key>-<filter>-<type><ext>"
+    static std::string file_name(const std::string& image_id, proto::ThumbnailType type);
+    std::string path_of(const std::string& name) const;
+
+    const std::string out_dir;
+    std::unique_ptr<ThumbnailStore> packed;
+    std::mutex mutex;
+    std::unordered_map<std::string, Entry> entries;
+    std::ofstream index;
+};
@@ -0,0 +1,344 @@
+#include "thumbnail_pipeline.h"
+
+#include <ThreadPool/ThreadPool.h>
+#include <boost/filesystem.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+#include "gen_thumbnails.h"
+#include "thumbnail_cache.h"
+
+using proto::ThumbnailType;
+
+bool parse_pipeline_config(const std::string& spec, PipelineConfig& config) {
+    PipelineConfig parsed = config;
+    std::stringstream entries(spec);
+    std::string entry;
+    while (std::getline(entries, entry, ',')) {
+        size_t equals = entry.find('=');
+        if (equals == std::string::npos) {
+            return false;
+        }
+        std::string name = entry.substr(0, equals);
+        std::string value = entry.substr(equals + 1);
+        char* end = nullptr;
+        long workers = std::strtol(value.c_str(), &end, 10);
+        if (value.empty() || *end != '\0' || workers <= 0) {
+            return false;
+        }
+        if (name == "read") {
+            parsed.readers = workers;
+        } else if (name == "decode") {
+            parsed.decoders = workers;
+        } else if (name == "resize") {
+            parsed.resizers = workers;
+        } else if (name == "write") {
+            parsed.writers = workers;
+        } else {
+            return false;
+        }
+    }
+    config = parsed;
+    return true;
+}
+
+namespace {
+
+// Holds at most capacity items; push waits while it is full, pop while it is empty.
+template <class T>
+class BoundedQueue final {
+   public:
+    explicit BoundedQueue(size_t capacity) : capacity(capacity) {}
+
+    // dropped once closed
+    void push(T item) {
+        std::unique_lock<std::mutex> lock(mutex);
+        not_full.wait(lock, [this] { return items.size() < capacity || closed; });
+        if (closed) {
+            return;
+        }
+        items.push_back(std::move(item));
+        not_empty.notify_one();
+    }
+
+    // false once closed and empty
+    bool pop(T& item) {
+        std::unique_lock<std::mutex> lock(mutex);
+        not_empty.wait(lock, [this] { return !items.empty() || closed; });
+        if (items.empty()) {
+            return false;
+        }
+        item = std::move(items.front());
+        items.pop_front();
+        not_full.notify_one();
+        return true;
+    }
+
+    void close() {
+        std::lock_guard<std::mutex> lock(mutex);
+        closed = true;
+        not_full.notify_all();
+        not_empty.notify_all();
+    }
+
+   private:
+    const size_t capacity;
+    std::mutex mutex;
+    std::condition_variable not_full;
+    std::condition_variable not_empty;
+    std::deque<T> items;
+    bool closed = false;
+};
+
+// One call of ThumbnailPipeline::run.
+struct Batch {
+    ThumbnailCache* cache = nullptr;
+    std::vector<ThumbnailType> levels;
+    ThumbnailPipeline::ResultCallback on_result;
+
+    std::mutex mutex;
+    std::condition_variable done;
+    // sources submitted and not finished yet
+    size_t pending = 0;
+};
+
+// One source on its way through the stages; each stage frees what it consumed.
+struct Job {
+    std::shared_ptr<Batch> batch;
+    std::string path;
+    // read
+    std::string bytes;
+    std::string image_id;
+    // the batch's levels that are not cached yet
+    std::vector<ThumbnailType> levels;
+    // decoded
+    DecodedSource source;
+    // writes not done yet, plus one while the resizer may still add some
+    std::atomic<int> pending_writes{1};
+    // guards result once the writes have started
+    std::mutex mutex;
+    proto::ThumbnailBatchResult result;
+};
+
+using JobPtr = std::shared_ptr<Job>;
+
+struct WriteItem {
+    JobPtr job;
+    ThumbnailType type = ThumbnailType::Small;
+    ThumbnailImage image;
+};
+
+}  // namespace
+
+// the named decode pool's Config, with config.decoders workers if given
+static ThreadPool::Config decoder_config(const PipelineConfig& config) {
+    ThreadPool::Config decoders = ThreadPool::NamedConfig(ThreadPool::kDecodePool);
+    if (config.decoders > 0) {
+        decoders.size = config.decoders;
+    }
+    decoders.size = std::max<size_t>(1, decoders.size);
+    // each worker runs one loop, there is nothing to steal
+    decoders.scheduling = ThreadPool::Scheduling::SharedQueue;
+    return decoders;
+}
+
+struct ThumbnailPipeline::State {
+    State(const PipelineConfig& config, ResampleFilter filter)
+        : filter(filter),
+          decoders(decoder_config(config)),
+          to_read(2 * config.readers),
+          to_decode(2 * decoders.size),
+          to_resize(2 * config.resizers),
+          to_write(2 * config.writers),
+          read_pool("thumb-read", config.readers),
+          decode_pool("thumb-decode", decoders),
+          resize_pool("thumb-resize", config.resizers),
+          write_pool("thumb-write", config.writers) {
+        // each worker runs one loop for the life of the pipeline
+        start(read_pool, &State::read_loop);
+        start(decode_pool, &State::decode_loop);
+        start(resize_pool, &State::resize_loop);
+        start(write_pool, &State::write_loop);
+    }
+
+    void start(ThreadPool& pool, void (State::*loop)()) {
+        for (size_t i = 0; i < pool.size(); i++) {
+            pool.post([this, loop] { (this->*loop)(); });
+        }
+    }
+
+    void close() {
+        to_read.close();
+        to_decode.close();
+        to_resize.close();
+        to_write.close();
+    }
+
+    void read_loop() {
+        for (JobPtr job; to_read.pop(job); job.reset()) {
+            try {
+                read_file(job->path, job->bytes);
+            } catch (std::exception& ex) {
+                fail(job, ex.what());
+                continue;
+            }
+            // a source seen before skips the other stages
+            job->image_id =
+                thumbnail_image_id(ThumbnailCache::source_key(job->bytes), job->path, filter);
+            job->levels = job->batch->levels;
+            for (proto::Thumbnail& thumbnail :
+                 take_cached_levels(*job->batch->cache, job->image_id, job->levels)) {
+                job->result.add_data()->Swap(&thumbnail);
+            }
+            if (job->levels.empty()) {
+                finish(*job);
+                continue;
+            }
+            to_decode.push(std::move(job));
+        }
+    }
+
+    void decode_loop() {
+        for (JobPtr job; to_decode.pop(job); job.reset()) {
+            if (auto small = take_embedded_small(*job->batch->cache, job->image_id, job->bytes,
+                                                 filter, job->levels)) {
+                job->result.add_data()->Swap(&*small);
+                if (job->levels.empty()) {
+                    job->bytes = std::string();
+                    finish(*job);
+                    continue;
+                }
+            }
+            bool decoded = false;
+            std::string error = "unsupported format";
+            try {
+                decoded = decode_source(job->path, job->bytes, job->levels, filter, job->source);
+            } catch (std::exception& ex) {
+                error = ex.what();
+            }
+            job->bytes = std::string();
+            if (!decoded) {
+                fail(job, error);
+                continue;
+            }
+            to_resize.push(std::move(job));
+        }
+    }
+
+    void resize_loop() {
+        for (JobPtr job; to_resize.pop(job); job.reset()) {
+            // one source per worker, the workers resize different sources in parallel
+            try {
+                resample_source(job->source, job->levels, filter, nullptr,
+                                [&](ThumbnailType type, ThumbnailImage image) {
+                                    job->pending_writes++;
+                                    to_write.push(WriteItem{job, type, std::move(image)});
+                                });
+            } catch (std::exception& ex) {
+                std::lock_guard<std::mutex> lock(job->mutex);
+                job->result.set_error(ex.what());
+            }
+            job->source = DecodedSource();
+            release_write(job);
+        }
+    }
+
+    void write_loop() {
+        for (WriteItem item; to_write.pop(item); item = WriteItem()) {
+            Job& job = *item.job;
+            if (auto thumbnail =
+                    write_thumbnail(*job.batch->cache, job.image_id, item.type, *item.image)) {
+                std::lock_guard<std::mutex> lock(job.mutex);
+                job.result.add_data()->Swap(&*thumbnail);
+            }
+            release_write(item.job);
+        }
+    }
+
+    void release_write(const JobPtr& job) {
+        if (job->pending_writes.fetch_sub(1) == 1) {
+            finish(*job);
+        }
+    }
+
+    void fail(const JobPtr& job, const std::string& error) {
+        std::cerr << job->path << ": " << error << std::endl;
+        job->result.set_error(error);
+        finish(*job);
+    }
+
+    void finish(Job& job) {
+        Batch& batch = *job.batch;
+        batch.on_result(job.result);
+        std::lock_guard<std::mutex> lock(batch.mutex);
+        if (--batch.pending == 0) {
+            batch.done.notify_all();
+        }
+    }
+
+    const ResampleFilter filter;
+    const ThreadPool::Config decoders;
+    BoundedQueue<JobPtr> to_read;
+    BoundedQueue<JobPtr> to_decode;
+    BoundedQueue<JobPtr> to_resize;
+    BoundedQueue<WriteItem> to_write;
+    // after the queues, so that the workers are joined while the queues still exist
+    ThreadPool read_pool;
+    ThreadPool decode_pool;
+    ThreadPool resize_pool;
+    ThreadPool write_pool;
+};
+
+ThumbnailPipeline::ThumbnailPipeline(const PipelineConfig& config, ResampleFilter filter)
+    : state(std::make_unique<State>(config, filter)) {}
+
+ThumbnailPipeline::~ThumbnailPipeline() { state->close(); }
+
+void ThumbnailPipeline::run(const proto::GenerateThumbnailsBatchRequest& req,
+                            const ResultCallback& on_result) {
+    auto batch = std::make_shared<Batch>();
+    batch->cache = &ThumbnailCache::for_dir(req.out_dir());
+    batch->levels = thumbnail_levels(std::vector<int>(req.types().begin(), req.types().end()));
+    batch->on_result = on_result;
+
+    auto submit = [&](const std::string& path) {
+        auto job = std::make_shared<Job>();
+        job->batch = batch;
+        job->path = path;
+        job->result.set_source_path(path);
+        {
+            std::lock_guard<std::mutex> lock(batch->mutex);
+            batch->pending++;
+        }
+        // waits while the readers are behind, so a large directory is walked as the
+        // pipeline drains rather than all at once
+        state->to_read.push(std::move(job));
+    };
+
+    for (const std::string& path : req.paths()) {
+        submit(path);
+    }
+    if (!req.root().empty()) {
+        namespace fs = boost::filesystem;
+        boost::system::error_code ec;
+        for (fs::recursive_directory_iterator it(req.root(), ec), end; !ec && it != end;
+             it.increment(ec)) {
+            if (fs::is_regular_file(it->status()) && has_thumbnail_format(it->path().string())) {
+                submit(it->path().string());
+            }
+        }
+        if (ec) {
+            std::cerr << req.root() << ": " << ec.message() << std::endl;
+        }
+    }
+
+    std::unique_lock<std::mutex> lock(batch->mutex);
+    batch->done.wait(lock, [&] { return batch->pending == 0; });
+}
@@ -0,0 +1,60 @@
+//
+// Thumbnails for batches of sources, e.g. a whole photo library being imported.
+//
+
+#pragma once
+
+#include <ipc-message/ipc.pb.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "resample.h"
+
+// Workers of each stage of a ThumbnailPipeline.
+struct PipelineConfig {
+    // read whole files into memory, ahead of the decoders
+    size_t readers = 2;
+    // decode, resampling the largest size on the way when streaming; 0 for as many as
+    // the named decode pool has workers
+    size_t decoders = 0;
+    // resample the smaller sizes
+    size_t resizers = std::max(1u, std::thread::hardware_concurrency() / 2);
+    // encode and write the files
+    size_t writers = std::max(1u, std::thread::hardware_concurrency() / 2);
+};
+
+// "read=2,decode=6,resize=3,write=3", stages not named keep their default
+bool parse_pipeline_config(const std::string& spec, PipelineConfig& config);
+
+// Sources go through four stages, each a pool of its own: read, decode, resize and
+// write. The decoders run on the CPUs and at the niceness of the named decode pool
+// (ThreadPool::kDecodePool), so that --pools confines batches as it does single
+// requests. Stages are connected by queues holding twice as many items as the stage they
+// feed has workers; a stage whose next queue is full waits, so the disk and every
+// core stay busy together while memory stays bounded by the queues.
+// Sources whose thumbnails are all in the output directory's ThumbnailCache leave
+// after the read stage.
+class ThumbnailPipeline final {
+   public:
+    using ResultCallback = std::function<void(const proto::ThumbnailBatchResult&)>;
+
+    ThumbnailPipeline(const PipelineConfig& config, ResampleFilter filter);
+    // no run() may still be in progress
+    ~ThumbnailPipeline();
+    ThumbnailPipeline(const ThumbnailPipeline&) = delete;
+    void operator=(const ThumbnailPipeline&) = delete;
+
+    // Runs every source of req through the stages and calls on_result once per source,
+    // from a worker, when its last thumbnail is written or it failed. Returns when all
+    // are done. Batches run at the same time share the stages.
+    void run(const proto::GenerateThumbnailsBatchRequest& req, const ResultCallback& on_result);
+
+   private:
+    struct State;
+    std::unique_ptr<State> state;
+};
@@ -0,0 +1,411 @@
+#include "thumbnail_store.h"
+
+#include <ThreadPool/ThreadPool.h>
+#include <boost/filesystem.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "mapped_fd.h"
+
+namespace fs = boost::filesystem;
+
+static constexpr char IndexFileName[] = "index";
+static constexpr char SegmentExtension[] = ".seg";
+
+static constexpr char PutRecord = 'P';
+static constexpr char RemoveRecord = 'R';
+
+// An index record: op, unused, key length, segment, offset, size, width, height, all
+// little-endian, followed by the key.
+static constexpr size_t RecordHeaderSize = 24;
+
+template <typename T>
+static void put_field(char*& p, T value) {
+    std::memcpy(p, &value, sizeof(value));
+    p += sizeof(value);
+}
+
+template <typename T>
+static T get_field(const char*& p) {
+    T value;
+    std::memcpy(&value, p, sizeof(value));
+    p += sizeof(value);
+    return value;
+}
+
+ThumbnailStore::ThumbnailStore(const std::string& dir, ThreadPool* compaction_pool,
+                               uint64_t segment_bytes)
+    : dir(dir), compaction_pool(compaction_pool), segment_bytes(segment_bytes) {
+    boost::system::error_code ec;
+    fs::create_directories(dir, ec);
+    for (fs::directory_iterator it(dir, ec), end; !ec && it != end; it.increment(ec)) {
+        const fs::path& path = it->path();
+        std::string stem = path.stem().string();
+        char* rest = nullptr;
+        unsigned long segment = std::strtoul(stem.c_str(), &rest, 10);
+        if (path.extension() == SegmentExtension && *rest == '\0' && segment > 0) {
+            segments[static_cast<uint32_t>(segment)].size = fs::file_size(path, ec);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    bool rewrite = load_index();
+
+    // segments nothing points to any more are what a compaction did not get to delete
+    uint32_t last = 0;
+    for (const auto& segment : segments) {
+        last = std::max(last, segment.first);
+    }
+    for (auto it = segments.begin(); it != segments.end();) {
+        if (it->second.live == 0 && it->first != last) {
+            fs::remove(segment_path(it->first), ec);
+            it = segments.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    if (last == 0 || segments[last].size >= segment_bytes) {
+        last++;
+    }
+    open_segment_locked(last);
+
+    if (rewrite) {
+        rewrite_index_locked();
+    } else {
+        index.open(fs::path(dir) / IndexFileName, std::ios::binary | std::ios::app);
+    }
+    if (!ok()) {
+        std::cerr << "cannot write the thumbnail store in " << dir << std::endl;
+    }
+}
+
+ThumbnailStore::~ThumbnailStore() {
+    std::future<void> pending;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending = std::move(compaction);
+    }
+    if (pending.valid()) {
+        pending.wait();
+    }
+}
+
+std::string ThumbnailStore::key_of(const std::string& image_id, proto::ThumbnailType type) {
+    return image_id + "/" + proto::ThumbnailType_Name(type);
+}
+
+std::string ThumbnailStore::segment_path(uint32_t segment) const {
+    char name[32];
+    std::snprintf(name, sizeof(name), "%08u%s", segment, SegmentExtension);
+    return (fs::path(dir) / name).string();
+}
+
+// Replays the index into locations. Returns true if it should be rewritten: it ends
+// in a record cut short, points past the end of a segment, or is mostly superseded.
+bool ThumbnailStore::load_index() {
+    std::ifstream file(fs::path(dir) / IndexFileName, std::ios::binary);
+    std::string log((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    size_t records = 0;
+    bool damaged = false;
+    const char* p = log.data();
+    const char* end = p + log.size();
+    while (end - p >= static_cast<ptrdiff_t>(RecordHeaderSize)) {
+        const char* record = p;
+        char op = get_field<char>(p);
+        get_field<char>(p);
+        uint16_t key_size = get_field<uint16_t>(p);
+        Location location;
+        location.segment = get_field<uint32_t>(p);
+        location.offset = get_field<uint64_t>(p);
+        location.size = get_field<uint32_t>(p);
+        location.width = get_field<uint16_t>(p);
+        location.height = get_field<uint16_t>(p);
+        if (end - p < key_size || (op != PutRecord && op != RemoveRecord)) {
+            p = record;
+            break;
+        }
+        std::string key(p, key_size);
+        p += key_size;
+        records++;
+
+        auto it = locations.find(key);
+        if (it != locations.end()) {
+            segments[it->second.segment].live -= it->second.size;
+            locations.erase(it);
+        }
+        if (op == PutRecord) {
+            auto segment = segments.find(location.segment);
+            if (segment == segments.end() ||
+                location.offset + location.size > segment->second.size) {
+                damaged = true;
+                continue;
+            }
+            segment->second.live += location.size;
+            locations.emplace(std::move(key), location);
+        }
+    }
+    return damaged || p != end || records > 2 * locations.size() + 1024;
+}
+
+bool ThumbnailStore::rewrite_index_locked() {
+    fs::path index_path = fs::path(dir) / IndexFileName;
+    fs::path rewritten_path = index_path;
+    rewritten_path += ".tmp";
+    std::ofstream rewritten(rewritten_path, std::ios::binary | std::ios::trunc);
+    for (const auto& [key, location] : locations) {
+        write_record(rewritten, PutRecord, key, location);
+    }
+    rewritten.close();
+
+    boost::system::error_code ec;
+    if (rewritten) {
+        index.close();
+        fs::rename(rewritten_path, index_path, ec);
+    }
+    if (!index.is_open()) {
+        index.clear();
+        index.open(index_path, std::ios::binary | std::ios::app);
+    }
+    return rewritten && !ec;
+}
+
+bool ThumbnailStore::open_segment_locked(uint32_t segment) {
+    current.close();
+    current.clear();
+    current.open(segment_path(segment), std::ios::binary | std::ios::app);
+    current_segment = segment;
+    segments[segment];
+    return current.is_open();
+}
+
+void ThumbnailStore::write_record(std::ostream& out, char op, const std::string& key,
+                                  const Location& location) {
+    char header[RecordHeaderSize];
+    char* p = header;
+    put_field<char>(p, op);
+    put_field<char>(p, 0);
+    put_field<uint16_t>(p, static_cast<uint16_t>(key.size()));
+    put_field<uint32_t>(p, location.segment);
+    put_field<uint64_t>(p, location.offset);
+    put_field<uint32_t>(p, location.size);
+    put_field<uint16_t>(p, location.width);
+    put_field<uint16_t>(p, location.height);
+    out.write(header, sizeof(header));
+    out.write(key.data(), static_cast<std::streamsize>(key.size()));
+}
+
+void ThumbnailStore::drop_locked(const Location& location) {
+    segments[location.segment].live -= location.size;
+}
+
+// The bytes are written before the index record that points to them, so a crash in
+// between leaves dead bytes rather than a record pointing at nothing.
+bool ThumbnailStore::append_locked(const std::string& key, uint16_t width, uint16_t height,
+                                   std::string_view encoded) {
+    if (segments[current_segment].size > 0 &&
+        segments[current_segment].size + encoded.size() > segment_bytes) {
+        if (!open_segment_locked(current_segment + 1)) {
+            return false;
+        }
+    }
+
+    Segment& segment = segments[current_segment];
+    current.write(encoded.data(), static_cast<std::streamsize>(encoded.size()));
+    if (!current.flush()) {
+        // the size of the segment is unknown now, the next thumbnail starts another
+        open_segment_locked(current_segment + 1);
+        return false;
+    }
+    Location location{current_segment, segment.size, static_cast<uint32_t>(encoded.size()),
+                      width, height};
+    segment.size += encoded.size();
+    segment.live += encoded.size();
+
+    write_record(index, PutRecord, key, location);
+    index.flush();
+
+    auto it = locations.find(key);
+    if (it != locations.end()) {
+        drop_locked(it->second);
+        it->second = location;
+    } else {
+        locations.emplace(key, location);
+    }
+    return true;
+}
+
+std::optional<ThumbnailBytes> ThumbnailStore::read_locked(const Location& location) const {
+    auto it = segments.find(location.segment);
+    if (it == segments.end()) {
+        return std::nullopt;
+    }
+    Segment& segment = it->second;
+    uint64_t end = location.offset + location.size;
+
+    // the current segment grows, it is mapped again once a read goes past the mapping
+    if (segment.mapped == nullptr || segment.mapped->bytes().size() < end) {
+        segment.mapped = nullptr;
+#ifndef _WIN32
+        int fd = ::open(segment_path(location.segment).c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd >= 0) {
+            auto mapped = std::make_shared<EasyIpc::MappedFd>();
+            if (mapped->Map(fd) && mapped->bytes().size() >= end) {
+                segment.mapped = std::move(mapped);
+            }
+            ::close(fd);
+        }
+#endif
+    }
+
+    ThumbnailBytes bytes;
+    bytes.width = location.width;
+    bytes.height = location.height;
+    if (segment.mapped != nullptr) {
+        bytes.data = segment.mapped->bytes().substr(location.offset, location.size);
+        bytes.owner = segment.mapped;
+        return bytes;
+    }
+
+    // no mmap (Windows): read the thumbnail alone
+    std::ifstream file(segment_path(location.segment), std::ios::binary);
+    auto data = std::make_shared<std::string>(location.size, '\0');
+    if (!file.seekg(static_cast<std::streamoff>(location.offset)) ||
+        !file.read(&(*data)[0], location.size)) {
+        return std::nullopt;
+    }
+    bytes.data = *data;
+    bytes.owner = std::move(data);
+    return bytes;
+}
+
+bool ThumbnailStore::put(const std::string& image_id, proto::ThumbnailType type, int width,
+                         int height, std::string_view encoded) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!ok() || !append_locked(key_of(image_id, type), static_cast<uint16_t>(width),
+                                static_cast<uint16_t>(height), encoded)) {
+        return false;
+    }
+    schedule_compaction_locked();
+    return true;
+}
+
+std::optional<ThumbnailBytes> ThumbnailStore::get(const std::string& image_id,
+                                                  proto::ThumbnailType type) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = locations.find(key_of(image_id, type));
+    if (it == locations.end()) {
+        return std::nullopt;
+    }
+    return read_locked(it->second);
+}
+
+bool ThumbnailStore::contains(const std::string& image_id, proto::ThumbnailType type) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return locations.count(key_of(image_id, type)) > 0;
+}
+
+bool ThumbnailStore::remove(const std::string& image_id, proto::ThumbnailType type) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = locations.find(key_of(image_id, type));
+    if (it == locations.end()) {
+        return false;
+    }
+    write_record(index, RemoveRecord, it->first, it->second);
+    index.flush();
+    drop_locked(it->second);
+    locations.erase(it);
+    schedule_compaction_locked();
+    return true;
+}
+
+bool ThumbnailStore::should_compact_locked() const {
+    for (const auto& [number, segment] : segments) {
+        if (number != current_segment && segment.size > 0 && 2 * segment.live <= segment.size) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThumbnailStore::schedule_compaction_locked() {
+    if (compaction_pool == nullptr || compaction_scheduled || !should_compact_locked()) {
+        return;
+    }
+    compaction_scheduled = true;
+    compaction = compaction_pool->add_task([this] { compact(); });
+}
+
+// The thumbnails are moved one at a time, so reads and puts go on in between; one that
+// was replaced or removed meanwhile is left alone.
+void ThumbnailStore::compact() {
+    std::lock_guard<std::mutex> serial(compaction_mutex);
+
+    std::vector<uint32_t> victims;
+    std::vector<std::pair<std::string, Location>> moving;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        compaction_scheduled = false;
+        for (const auto& [number, segment] : segments) {
+            if (number != current_segment && segment.size > 0 &&
+                2 * segment.live <= segment.size) {
+                victims.push_back(number);
+            }
+        }
+        if (victims.empty()) {
+            return;
+        }
+        for (const auto& [key, location] : locations) {
+            if (std::find(victims.begin(), victims.end(), location.segment) != victims.end()) {
+                moving.emplace_back(key, location);
+            }
+        }
+    }
+
+    for (const auto& [key, location] : moving) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = locations.find(key);
+        if (it == locations.end() || it->second.segment != location.segment ||
+            it->second.offset != location.offset) {
+            continue;
+        }
+        if (auto bytes = read_locked(location)) {
+            append_locked(key, location.width, location.height, bytes->data);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (uint32_t victim : victims) {
+        auto it = segments.find(victim);
+        if (it != segments.end() && it->second.live == 0) {
+            // readers still holding its bytes keep the mapping, not the file
+            boost::system::error_code ec;
+            fs::remove(segment_path(victim), ec);
+            segments.erase(it);
+        }
+    }
+    rewrite_index_locked();
+}
+
+ThumbnailStore::Stats ThumbnailStore::stats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    Stats stats;
+    stats.thumbnails = locations.size();
+    stats.segments = segments.size();
+    for (const auto& segment : segments) {
+        stats.live_bytes += segment.second.live;
+        stats.dead_bytes += segment.second.size - segment.second.live;
+    }
+    return stats;
+}
@@ -0,0 +1,124 @@
+//
+// Encoded thumbnails packed into a few large files instead of one small file each.
+//
+
+#pragma once
+
+#include <ipc-message/ipc.pb.h>
+
+#include <cstdint>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace EasyIpc {
+class MappedFd;
+}
+class ThreadPool;
+
+// The encoded bytes of a stored thumbnail, valid as long as the object is: they stay
+// mapped (or read) even if the thumbnail is replaced, removed or compacted meanwhile.
+struct ThumbnailBytes {
+    std::shared_ptr<const void> owner;
+    std::string_view data;
+    int width = 0;
+    int height = 0;
+};
+
+// A directory of append-only segment files ("00000001.seg", ...) holding the encoded
+// thumbnails back to back, and "index", a log of fixed-size records (plus the key)
+// saying where each one is or that it was removed. The index is read into memory when
+// the store is opened; the segments are read through mmap, so repeated reads of the
+// same thumbnails come from the page cache without opening anything.
+//
+// Replacing or removing a thumbnail leaves its bytes behind. Once at least half of a
+// full segment is such dead bytes, the thumbnails still alive in it are copied to the
+// current segment and it is deleted, on compaction_pool when given.
+class ThumbnailStore final {
+   public:
+    static constexpr uint64_t DefaultSegmentBytes = 64 << 20;
+
+    ThumbnailStore(const std::string& dir, ThreadPool* compaction_pool = nullptr,
+                   uint64_t segment_bytes = DefaultSegmentBytes);
+    // waits for a compaction in progress
+    ~ThumbnailStore();
+    ThumbnailStore(const ThumbnailStore&) = delete;
+    void operator=(const ThumbnailStore&) = delete;
+
+    // false if the store's files cannot be written (e.g. the directory is not writable)
+    bool ok() const { return index.is_open(); }
+
+    // Appends the thumbnail of type for image_id, replacing any earlier one. false if
+    // it cannot be written.
+    bool put(const std::string& image_id, proto::ThumbnailType type, int width, int height,
+             std::string_view encoded);
+    std::optional<ThumbnailBytes> get(const std::string& image_id,
+                                      proto::ThumbnailType type) const;
+    bool contains(const std::string& image_id, proto::ThumbnailType type) const;
+    // false if there was none
+    bool remove(const std::string& image_id, proto::ThumbnailType type);
+
+    // Rewrites the segments that are at least half dead, then the index. Called on
+    // compaction_pool by itself when there is one.
+    void compact();
+
+    struct Stats {
+        size_t thumbnails = 0;
+        size_t segments = 0;
+        uint64_t live_bytes = 0;
+        uint64_t dead_bytes = 0;
+    };
+    Stats stats() const;
+
+   private:
+    struct Location {
+        uint32_t segment;
+        uint64_t offset;
+        uint32_t size;
+        uint16_t width;
+        uint16_t height;
+    };
+
+    struct Segment {
+        // bytes written
+        uint64_t size = 0;
+        // bytes of it the index still points to
+        uint64_t live = 0;
+        // covers at least the first size bytes once get has been called
+        std::shared_ptr<EasyIpc::MappedFd> mapped;
+    };
+
+    static std::string key_of(const std::string& image_id, proto::ThumbnailType type);
+    std::string segment_path(uint32_t segment) const;
+    bool load_index();
+    bool rewrite_index_locked();
+    bool open_segment_locked(uint32_t segment);
+    bool append_locked(const std::string& key, uint16_t width, uint16_t height,
+                       std::string_view encoded);
+    static void write_record(std::ostream& out, char op, const std::string& key,
+                             const Location& location);
+    void drop_locked(const Location& location);
+    std::optional<ThumbnailBytes> read_locked(const Location& location) const;
+    bool should_compact_locked() const;
+    void schedule_compaction_locked();
+
+    const std::string dir;
+    ThreadPool* const compaction_pool;
+    const uint64_t segment_bytes;
+
+    mutable std::mutex mutex;
+    std::unordered_map<std::string, Location> locations;
+    mutable std::unordered_map<uint32_t, Segment> segments;
+    uint32_t current_segment = 0;
+    std::ofstream current;
+    std::ofstream index;
+    bool compaction_scheduled = false;
+    std::future<void> compaction;
+    // one compaction at a time
+    std::mutex compaction_mutex;
+};
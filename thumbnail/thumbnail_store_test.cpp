@@ -0,0 +1,149 @@
+#include "thumbnail_store.h"
+
+#include <boost/filesystem.hpp>
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace fs = boost::filesystem;
+
+class ThumbnailStoreTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        dir = fs::temp_directory_path() / fs::unique_path("thumbnail-store-%%%%-%%%%");
+    }
+    void TearDown() override {
+        boost::system::error_code ec;
+        fs::remove_all(dir, ec);
+    }
+
+    std::string bytes_of(const ThumbnailStore& store, const std::string& image_id,
+                         proto::ThumbnailType type = proto::Small) {
+        auto bytes = store.get(image_id, type);
+        return bytes ? std::string(bytes->data) : std::string();
+    }
+
+    fs::path dir;
+};
+
+TEST_F(ThumbnailStoreTest, ReadsBackAfterReopen) {
+    {
+        ThumbnailStore store(dir.string());
+        ASSERT_TRUE(store.ok());
+        ASSERT_TRUE(store.put("a", proto::Small, 4, 3, "small a"));
+        ASSERT_TRUE(store.put("a", proto::Large, 40, 30, "large a"));
+        ASSERT_TRUE(store.put("b", proto::Small, 4, 3, "old b"));
+        ASSERT_TRUE(store.put("b", proto::Small, 4, 3, "new b"));
+    }
+
+    ThumbnailStore store(dir.string());
+    EXPECT_EQ(bytes_of(store, "a"), "small a");
+    EXPECT_EQ(bytes_of(store, "a", proto::Large), "large a");
+    EXPECT_EQ(bytes_of(store, "b"), "new b");
+    EXPECT_FALSE(store.contains("a", proto::Medium));
+    auto bytes = store.get("a", proto::Large);
+    ASSERT_TRUE(bytes);
+    EXPECT_EQ(bytes->width, 40);
+    EXPECT_EQ(bytes->height, 30);
+    EXPECT_EQ(store.stats().thumbnails, 3u);
+    EXPECT_EQ(store.stats().dead_bytes, 5u);
+}
+
+TEST_F(ThumbnailStoreTest, RemovedStaysRemovedAfterReopen) {
+    {
+        ThumbnailStore store(dir.string());
+        ASSERT_TRUE(store.put("a", proto::Small, 4, 3, "a"));
+        ASSERT_TRUE(store.put("b", proto::Small, 4, 3, "b"));
+        EXPECT_TRUE(store.remove("a", proto::Small));
+        EXPECT_FALSE(store.remove("a", proto::Small));
+        EXPECT_FALSE(store.contains("a", proto::Small));
+    }
+
+    ThumbnailStore store(dir.string());
+    EXPECT_FALSE(store.contains("a", proto::Small));
+    EXPECT_EQ(bytes_of(store, "b"), "b");
+    EXPECT_EQ(store.stats().thumbnails, 1u);
+    EXPECT_EQ(store.stats().dead_bytes, 1u);
+}
+
+// A crash while appending leaves the last index record cut short: it is dropped, the
+// records before it are kept, and the index is rewritten whole so that appending goes on.
+TEST_F(ThumbnailStoreTest, ReopensAfterTruncatedIndex) {
+    {
+        ThumbnailStore store(dir.string());
+        ASSERT_TRUE(store.put("a", proto::Small, 4, 3, "a"));
+        ASSERT_TRUE(store.put("b", proto::Small, 4, 3, "b"));
+        ASSERT_TRUE(store.remove("a", proto::Small));
+        ASSERT_TRUE(store.put("c", proto::Small, 4, 3, "c"));
+    }
+    fs::path index = dir / "index";
+    fs::resize_file(index, fs::file_size(index) - 3);
+
+    {
+        ThumbnailStore store(dir.string());
+        ASSERT_TRUE(store.ok());
+        EXPECT_FALSE(store.contains("a", proto::Small));
+        EXPECT_EQ(bytes_of(store, "b"), "b");
+        EXPECT_FALSE(store.contains("c", proto::Small));
+        ASSERT_TRUE(store.put("c", proto::Small, 4, 3, "c again"));
+        ASSERT_TRUE(store.put("d", proto::Small, 4, 3, "d"));
+    }
+
+    ThumbnailStore store(dir.string());
+    EXPECT_FALSE(store.contains("a", proto::Small));
+    EXPECT_EQ(bytes_of(store, "b"), "b");
+    EXPECT_EQ(bytes_of(store, "c"), "c again");
+    EXPECT_EQ(bytes_of(store, "d"), "d");
+    EXPECT_EQ(store.stats().thumbnails, 3u);
+}
+
+// An index pointing past the end of a segment (the segment lost its tail) drops the
+// thumbnails that are not there.
+TEST_F(ThumbnailStoreTest, ReopensAfterTruncatedSegment) {
+    {
+        ThumbnailStore store(dir.string());
+        ASSERT_TRUE(store.put("a", proto::Small, 4, 3, "aaaa"));
+        ASSERT_TRUE(store.put("b", proto::Small, 4, 3, "bbbb"));
+    }
+    fs::path segment = dir / "00000001.seg";
+    fs::resize_file(segment, fs::file_size(segment) - 2);
+
+    ThumbnailStore store(dir.string());
+    EXPECT_EQ(bytes_of(store, "a"), "aaaa");
+    EXPECT_FALSE(store.contains("b", proto::Small));
+}
+
+// Segments at least half dead have their live thumbnails moved to the current one and
+// are deleted.
+TEST_F(ThumbnailStoreTest, CompactsHalfDeadSegments) {
+    {
+        // two thumbnails a segment: "ab", "cd", then "ef" the current one
+        ThumbnailStore store(dir.string(), nullptr, 8);
+        for (const char* id : {"a", "b", "c", "d", "e", "f"}) {
+            ASSERT_TRUE(store.put(id, proto::Small, 4, 3, std::string(4, *id)));
+        }
+        ASSERT_TRUE(store.remove("a", proto::Small));
+        ASSERT_TRUE(store.remove("c", proto::Small));
+        ASSERT_TRUE(store.remove("d", proto::Small));
+        EXPECT_EQ(store.stats().segments, 3u);
+
+        store.compact();
+        ThumbnailStore::Stats stats = store.stats();
+        EXPECT_EQ(stats.thumbnails, 3u);
+        EXPECT_EQ(stats.live_bytes, 12u);
+        EXPECT_EQ(stats.dead_bytes, 0u);
+        // "ef" and the one b was moved to
+        EXPECT_EQ(stats.segments, 2u);
+        EXPECT_FALSE(fs::exists(dir / "00000001.seg"));
+        EXPECT_FALSE(fs::exists(dir / "00000002.seg"));
+    }
+
+    ThumbnailStore store(dir.string(), nullptr, 8);
+    EXPECT_FALSE(store.contains("a", proto::Small));
+    EXPECT_EQ(bytes_of(store, "b"), "bbbb");
+    EXPECT_FALSE(store.contains("c", proto::Small));
+    EXPECT_FALSE(store.contains("d", proto::Small));
+    EXPECT_EQ(bytes_of(store, "e"), "eeee");
+    EXPECT_EQ(bytes_of(store, "f"), "ffff");
+    EXPECT_EQ(store.stats().dead_bytes, 0u);
+}